@@ -15,8 +15,10 @@
 
 #include <math/special.hpp>                  // math::floormod
 
-#include <field/poles/MonopoleVector.hpp>          // field::MonopoleVector
-#include <field/poles/DeepBarnesHutMultipole.hpp>  // field::DeepBarnesHutMultipole
+#include <field/poles/QuadrupoleVector.hpp>        // field::QuadrupoleVector
+#include <field/poles/FastMultipole.hpp>           // field::FastMultipole
+
+#include <model/nbody/Leapfrog.hpp>          // nbody::Leapfrog
 
 #include <unit/si.hpp>                       // si::unit
 
@@ -104,8 +106,8 @@ int main() {
   using ElementsAndState = orbit::ElementsAndState<double>;
   using Properties = orbit::Properties<double>;
 
-  using Monopole = field::MonopoleVector<2,double,dvec3>;
-  using Multipole = field::DeepBarnesHutMultipole<3,std::size_t,double,Monopole>;
+  using Quadrupole = field::QuadrupoleVector<2,double,dvec3>;
+  using Multipole = field::FastMultipole<3,std::size_t,double,Quadrupole>;
 
   Properties properties(
     dvec3(1,0,0), 
@@ -273,12 +275,19 @@ int main() {
     // si::year,
     // si::decayear
     // at 60fps, 1Dy/s roughly matches the original Nice model, which ran 1/4 year per timestep, 
-    // however they were probably using a better integration scheme like RK4,
-    // when we try that speed the planets are ejected after several years
+    // when we tried that speed using the explicit Euler method, the planets were ejected after several years,
+    // `nbody::Leapfrog` is symplectic, so energy no longer drifts, but timesteps must still be small compared to orbital periods
   };
 
-  // now introduce the Multipole field
-  Multipole gravitational_acceleration(dvec3(0), 1e13, 1e5);
+  // now introduce the Multipole field, which is rebuilt from every body each frame
+  Multipole gravitational_acceleration(0.3, 1e5);
+  std::vector<double> gravitational_parameters(masses.size());
+  for (std::size_t i = 0; i < masses.size(); ++i)
+  {
+    gravitational_parameters[i] = masses[i] * (si::gravitational_constant / (m3/(kg*s*s)));
+  }
+  nbody::Leapfrog<double,dvec3> leapfrog;
+  std::vector<dvec3> previous_positions(positions.size());
 
   int timestep_id(0);
   time t(0);
@@ -295,18 +304,12 @@ int main() {
 
       t+=dt;
 
-      gravitational_acceleration.clear();
-      for (std::size_t i = 0; i < positions.size(); ++i)
-      {
-        gravitational_acceleration.add(positions[i], masses[i] * (si::gravitational_constant / (m3/(kg*s*s))));
-      }
+      previous_positions = positions;
+      leapfrog.step(gravitational_acceleration, positions, velocities, gravitational_parameters, dt/s);
 
       for (std::size_t i = 0; i < positions.size(); ++i)
       {
-        auto acceleration = gravitational_acceleration(positions[i]);
-        velocities[i]      += acceleration  * (dt/s);
-        positions[i]       += velocities[i] * (dt/s);
-        parent_offsets[i]  += velocities[i] * (dt/s);
+        parent_offsets[i]  += positions[i] - previous_positions[i];
         instance_origins[i] = positions[i];
       }
 
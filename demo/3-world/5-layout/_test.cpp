@@ -0,0 +1,188 @@
+#pragma GCC diagnostic ignored "-Wunknown-pragmas" // disable warnings about openmp pragmas since the code can run without them
+
+/*
+This demo is a headless benchmark that reproduces the "single CrustSummary" vs. "multiple rasters" comparison
+of 5-profiling/phase2-results.tsv for the passes that read only one or two fields of a summary.
+"single CrustSummary" stores rasters of structs (`CrustSummary`, `FormationSummary`),
+"multiple rasters" stores one raster per field (`CrustSummaryRasters`, `FormationSummaryRasters`).
+Output is a tab separated table that can be appended to layout-results.tsv.
+*/
+
+// std libraries
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <array>
+#include <limits>
+#include <algorithm>
+
+// in house libraries
+#include <unit/si.hpp>
+
+#include <index/iterated/Nary.hpp>
+
+#include <grid/dymaxion/Grid.hpp>                   // dymaxion::Grid
+#include <grid/dymaxion/GridCache.hpp>              // dymaxion::GridCache
+
+#include <raster/unlayered/VectorCalculusByFundamentalTheorem.hpp> // unlayered::VectorCalculusByFundamentalTheorem
+
+#include <model/rock/formation/EarthlikeIgneousFormationGeneration.hpp>
+#include <model/rock/stratum/StratumProperties.hpp>
+#include <model/rock/stratum/StratumSummarization.hpp>
+#include <model/rock/formation/Formation.hpp>
+#include <model/rock/formation/FormationSummarization.hpp>
+#include <model/rock/formation/FormationSummaryRasters.hpp>
+#include <model/rock/formation/FormationSummaryArchimedianDisplacement.hpp>
+#include <model/rock/crust/Crust.hpp>
+#include <model/rock/crust/CrustSummarization.hpp>
+#include <model/rock/crust/CrustSummaryOps.hpp>
+#include <model/rock/crust/CrustSummaryRasters.hpp>
+#include <model/rock/crust/CrustMotion.hpp>
+
+template<typename F>
+double seconds(const int frame_count, const F& f)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < frame_count; ++i)
+  {
+    f();
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+
+  using mass = si::mass<float>;
+  using density = si::density<float>;
+  using length = si::length<float>;
+  using pressure = si::pressure<float>;
+  using viscosity = si::dynamic_viscosity<float>;
+  using acceleration = si::acceleration<float>;
+
+  using Grid = dymaxion::Grid<std::int8_t, int, float>;
+
+  length meter(si::meter);
+  length world_radius(6.371e6 * si::meter);
+  density mantle_density(3000.0*si::kilogram/si::meter3);
+  viscosity mantle_viscosity(1.57e20*si::pascal*si::second);
+
+  iterated::Identity copy;
+
+  const int M(2);
+  const int F(5);
+  const int frame_count(1000);
+  const int batch_count(50);
+  const int pass_count(4);
+  const std::array<const char*,2> localizes{"single CrustSummary", "multiple rasters"};
+  const std::array<const char*,pass_count> passes{"flatten", "buoyancy", "displacement", "slab_volume"};
+
+  auto age_of_world = 0.0f*si::megayear;
+  std::array<relation::PolynomialRailyardRelation<si::time<double>,si::density<double>,0,1>, 2> densities_for_age {
+    relation::get_linear_interpolation_function(si::megayear, si::kilogram/si::meter3, {0.0, 250.0}, {2890.0, 3300.0}), // Carlson & Raskin 1984
+    relation::get_linear_interpolation_function(si::megayear, si::kilogram/si::meter3, {0.0, 250.0}, {2600.0, 2600.0})
+  };
+
+  rock::CrustSummaryOps crust_summary_ops{
+    rock::ColumnSummaryOps{
+      length(si::centimeter)
+    }
+  };
+
+  auto formation_summarize = rock::formation_summarization<2>(
+    rock::stratum_summarization<2>(
+      rock::AgedStratumDensity{densities_for_age, age_of_world},
+      mass(si::tonne)
+    ),
+    meter
+  );
+
+  auto crust_summarize = rock::crust_summarization<M,F>(formation_summarize, crust_summary_ops);
+
+  unlayered::VectorCalculusByFundamentalTheorem calculus;
+  auto motion = rock::crust_motion<M,float,double>(
+      calculus,
+      world_radius,
+      acceleration(si::standard_gravity),
+      mantle_density,
+      mantle_viscosity,
+      meter
+  );
+
+  rock::FormationSummaryArchimedianDisplacement displacement(density(3300.0*si::kilogram/si::meter3));
+
+  std::cout << "frame_count\tvertices_per_fine_square_side\tlocalize\tpass\tseconds" << std::endl;
+  for (int vertices_per_fine_square_side : {30, 60, 120})
+  {
+    dymaxion::GridCache fine(Grid(world_radius/meter, vertices_per_fine_square_side));
+
+    rock::EarthlikeIgneousFormationGeneration earthlike(fine, world_radius/2.0f, 0.5f, 10);
+    auto generation = earthlike(12.0f, 1.1e4f);
+    rock::StratumStore<M> empty_stratum;
+    rock::Formation<M> empty_formation(fine.vertex_count(), empty_stratum);
+    rock::Formation<M> igneous_formation(fine.vertex_count());
+    copy(generation, igneous_formation);
+    rock::Crust<M,F> crust{empty_formation, empty_formation, empty_formation, igneous_formation, empty_formation};
+
+    rock::CrustSummary crust_summary(fine.vertex_count());
+    rock::FormationSummary formation_summary(fine.vertex_count());
+    crust_summarize(fine, 1, crust, crust_summary, formation_summary);
+
+    std::vector<bool> is_slab(fine.vertex_count());
+    for (std::size_t i = 0; i < is_slab.size(); ++i)
+    {
+      is_slab[i] = i%3==0;
+    }
+
+    rock::FormationSummary formation_summary_structs(fine.vertex_count());
+    rock::CrustSummaryRasters crust_summary_rasters(crust_summary);
+    rock::FormationSummaryRasters formation_summary_rasters(fine.vertex_count());
+
+    std::vector<pressure> buoyancy(fine.vertex_count());
+    std::vector<length> displacements(fine.vertex_count());
+    si::volume<double> volume(0.0);
+    auto batch = [&](const auto& crust, auto& formation) {
+      const int batch_frame_count(frame_count/batch_count);
+      return std::array<double,pass_count>{
+        seconds(batch_frame_count, [&](){ crust_summary_ops.flatten(crust, formation); }),
+        seconds(batch_frame_count, [&](){ motion.buoyancy(formation, buoyancy); }),
+        seconds(batch_frame_count, [&](){ displacement(formation, displacements); }),
+        seconds(batch_frame_count, [&](){ volume += motion.slab_volume(fine, formation, is_slab); })
+      };
+    };
+
+    /*
+    Frames run in batches that alternate between layouts, so that both layouts see the same load from other processes,
+    and each row reports the fastest batch of its layout and pass, scaled up to `frame_count` frames.
+    */
+    std::array<std::array<double,pass_count>,2> fastest;
+    for (auto& durations : fastest)
+    {
+      durations.fill(std::numeric_limits<double>::max());
+    }
+    for (int i = 0; i < batch_count; ++i)
+    {
+      const std::array<std::array<double,pass_count>,2> durations {
+        batch(crust_summary,         formation_summary_structs),
+        batch(crust_summary_rasters, formation_summary_rasters)
+      };
+      for (std::size_t j = 0; j < durations.size(); ++j)
+      {
+        for (int k = 0; k < pass_count; ++k)
+        {
+          fastest[j][k] = std::min(fastest[j][k], durations[j][k]);
+        }
+      }
+    }
+    for (std::size_t j = 0; j < fastest.size(); ++j)
+    {
+      for (int k = 0; k < pass_count; ++k)
+      {
+        std::cout << frame_count << "\t" << vertices_per_fine_square_side << "\t" << localizes[j] << "\t" << passes[k] << "\t" << fastest[j][k] * batch_count << std::endl;
+      }
+    }
+    // print the accumulated results so that the compiler cannot discard the passes
+    std::cerr << buoyancy[0]/pressure(si::pascal) << " " << displacements[0]/meter << " " << volume/si::volume<double>(si::meter3) << std::endl;
+  }
+
+  return 0;
+}
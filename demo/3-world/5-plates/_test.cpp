@@ -0,0 +1,157 @@
+#pragma GCC diagnostic ignored "-Wunknown-pragmas" // disable warnings about openmp pragmas since the code can run without them
+
+/*
+This demo is a headless benchmark that reports the cost of the summary pipeline of 6-interaction
+(summarize, globalize, flatten, localize) as the plate count scales from 8 up to the maximum that is
+allowed by `ROCK_PLATE_ID_MASK`, see `PlateIdBitset`.
+Every plate carries the same crust so that every cell is occupied by every plate,
+which is the worst case for the plate id bitset operations within `flatten`.
+Output is a tab separated table that can be appended to plates-results.tsv.
+*/
+
+// std libraries
+#include <iostream>
+#include <vector>
+#include <chrono>
+
+// glm libraries
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// in house libraries
+#include <unit/si.hpp>
+
+#include <index/iterated/Nary.hpp>
+
+#include <grid/dymaxion/Grid.hpp>                   // dymaxion::Grid
+#include <grid/dymaxion/GridCache.hpp>              // dymaxion::GridCache
+
+#include <model/rock/stratum/PlateIdBitset.hpp>
+#include <model/rock/stratum/StratumProperties.hpp>
+#include <model/rock/stratum/StratumSummarization.hpp>
+#include <model/rock/formation/Formation.hpp>
+#include <model/rock/formation/FormationSummarization.hpp>
+#include <model/rock/formation/EarthlikeIgneousFormationGeneration.hpp>
+#include <model/rock/crust/Crust.hpp>
+#include <model/rock/crust/CrustSummarization.hpp>
+#include <model/rock/crust/CrustSummaryOps.hpp>
+#include <model/rock/lithosphere/Lithosphere.hpp>
+#include <model/rock/lithosphere/LithosphereSummary.hpp>
+#include <model/rock/lithosphere/LithosphereSummarization.hpp>
+#include <model/rock/lithosphere/LithosphereReferenceFrames.hpp>
+#include <model/rock/lithosphere/LithosphereResamplingPlan.hpp>
+
+int main() {
+
+  using mass = si::mass<float>;
+  using length = si::length<float>;
+
+  using mat3 = glm::mat3;
+  using mat4 = glm::mat4;
+
+  using Grid = dymaxion::Grid<std::int8_t, int, float>;
+
+  length meter(si::meter);
+  length world_radius(6.371e6 * si::meter);
+
+  iterated::Identity copy;
+
+  const int M(2);
+  const int F(5);
+  const int frame_count(20);
+  const int vertices_per_fine_square_side(60);
+
+  dymaxion::GridCache fine(Grid(world_radius/meter, vertices_per_fine_square_side));
+
+  rock::EarthlikeIgneousFormationGeneration earthlike(fine, world_radius/2.0f, 0.5f, 10);
+  auto generation = earthlike(12.0f, 1.1e4f);
+  rock::StratumStore<M> empty_stratum;
+  rock::Formation<M> empty_formation(fine.vertex_count(), empty_stratum);
+  rock::Formation<M> igneous_formation(fine.vertex_count());
+  copy(generation, igneous_formation);
+  rock::Crust<M,F> crust{empty_formation, empty_formation, empty_formation, igneous_formation, empty_formation};
+
+  auto age_of_world = 0.0f*si::megayear;
+  std::array<relation::PolynomialRailyardRelation<si::time<double>,si::density<double>,0,1>, 2> densities_for_age {
+    relation::get_linear_interpolation_function(si::megayear, si::kilogram/si::meter3, {0.0, 250.0}, {2890.0, 3300.0}), // Carlson & Raskin 1984
+    relation::get_linear_interpolation_function(si::megayear, si::kilogram/si::meter3, {0.0, 250.0}, {2600.0, 2600.0})
+  };
+
+  rock::CrustSummaryOps crust_summary_ops{
+    rock::ColumnSummaryOps{
+      length(si::centimeter)
+    }
+  };
+
+  auto crust_summarize = rock::crust_summarization<M,F>(
+    rock::formation_summarization<2>(
+      rock::stratum_summarization<2>(
+        rock::AgedStratumDensity{densities_for_age, age_of_world},
+        mass(0.0*si::tonne)
+      ),
+      meter
+    ), crust_summary_ops);
+  auto summarization = rock::lithosphere_summarization<M,F>(crust_summarize, crust_summary_ops);
+
+  auto frames = rock::lithosphere_reference_frames<int,float,mat3>(
+    dymaxion::NearestVertexId<std::int8_t,int,float>(fine.grid),
+    fine.vertex_positions
+  );
+
+  rock::CrustSummary crust_summary(fine.vertex_count());
+  rock::CrustSummary master(fine.vertex_count());
+
+  std::cout << "max_plate_count\tplate_count\tvertices_per_fine_square_side\tframe_count\tsummarize\tglobalize\tflatten\tlocalize\tmaster_plate_count" << std::endl;
+  for (int P : {8, 16, 32, 64})
+  {
+    if (std::size_t(P) > rock::PlateIds::max_plate_count)
+    {
+      break;
+    }
+
+    auto plates = rock::Lithosphere<M,F>(P, crust);
+    auto locals = rock::LithosphereSummary(P, crust_summary);
+    auto globals = rock::LithosphereSummary(P, crust_summary);
+    std::vector<rock::CrustSummary> localized(P, crust_summary);
+    rock::FormationSummary scratch(fine.vertex_count());
+    std::vector<mat3> orientations(P, mat3(1));
+    auto plan = rock::lithosphere_resampling_plan<int,float,mat3>(fine, fine.vertex_positions, 1e-6f, 0.1f);
+
+    std::chrono::duration<double> summarize(0), globalize(0), flatten(0), localize(0);
+    for (int frame = 0; frame < frame_count; ++frame)
+    {
+      for (int i = 0; i < P; ++i)
+      {
+        orientations[i] = mat3(glm::rotate(mat4(orientations[i]), 0.003f, glm::normalize(glm::vec3(1.0f, float(i), float(P-i)))));
+      }
+      auto t0 = std::chrono::steady_clock::now();
+      summarization .summarize (fine, plates, locals, scratch);
+      auto t1 = std::chrono::steady_clock::now();
+      plan          .update    (orientations);
+      frames        .globalize (plan, locals, globals);
+      auto t2 = std::chrono::steady_clock::now();
+      summarization .flatten   (globals, master);
+      auto t3 = std::chrono::steady_clock::now();
+      frames        .localize  (plan, master, localized);
+      auto t4 = std::chrono::steady_clock::now();
+      summarize += t1-t0;
+      globalize += t2-t1;
+      flatten   += t3-t2;
+      localize  += t4-t3;
+    }
+
+    int master_plate_count(0);
+    for (std::size_t i = 0; i < master.size(); ++i)
+    {
+      master_plate_count = std::max(master_plate_count, master[i].plate_count());
+    }
+
+    std::cout
+      << rock::PlateIds::max_plate_count << "\t" << P << "\t" << vertices_per_fine_square_side << "\t" << frame_count << "\t"
+      << summarize.count() << "\t" << globalize.count() << "\t" << flatten.count() << "\t" << localize.count() << "\t"
+      << master_plate_count << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,294 @@
+/*
+disable warnings about openmp pragmas - the code can run without them
+*/
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+/*
+disable warnings about std::free within the replacement operator delete below,
+which gcc reports when it inlines library calls to operator new
+*/
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+/*
+This demo is a headless test harness that runs the steady-state step of 6-interaction
+(everything within its frame loop except for drawing) while counting heap allocations.
+It exits with a nonzero status if any step after warm-up allocates,
+so that `make` within this directory fails.
+Every allocation within the step should instead be served by memory that was provided by the caller,
+such as the scratch arguments of `CrustOps`, `CrustSummaryPredicates`, and `LithosphereSummarization`.
+*/
+
+// C libraries
+#include <cstdlib> // std::malloc, std::free
+
+// std libraries
+#include <atomic>
+#include <iostream>
+#include <new>
+#include <vector>
+
+// glm libraries
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// in house libraries
+#include <index/procedural/Uniform.hpp>
+#include <index/adapted/symbolic/SymbolicArithmetic.hpp>
+#include <index/adapted/symbolic/SymbolicOrder.hpp>
+#include <index/adapted/boolean/BooleanBitset.hpp>
+#include <index/aggregated/Order.hpp>
+#include <index/iterated/Nary.hpp>
+#include <index/iterated/Arithmetic.hpp>
+#include <index/iterated/Bitset.hpp>
+
+#include <field/Uniform.hpp>                        // Uniform
+
+#include <grid/dymaxion/Grid.hpp>                   // dymaxion::Grid
+#include <grid/dymaxion/GridCache.hpp>              // dymaxion::GridCache
+
+#include <raster/unlayered/PackedMorphology.hpp>    // unlayered::PackedMorphology, unlayered::PackedMorphologyScratch
+
+#include <model/rock/mineral/GrainType.hpp>
+#include <model/rock/column/ColumnSummaryProperties.hpp>
+#include <model/rock/stratum/StratumProperties.hpp>
+#include <model/rock/stratum/StratumSummarization.hpp>
+#include <model/rock/formation/Formation.hpp>
+#include <model/rock/formation/FormationField.hpp>
+#include <model/rock/formation/FormationSummarization.hpp>
+#include <model/rock/formation/EarthlikeIgneousFormationGeneration.hpp>
+#include <model/rock/crust/Crust.hpp>
+#include <model/rock/crust/CrustOps.hpp>
+#include <model/rock/crust/CrustSummarization.hpp>
+#include <model/rock/crust/CrustSummaryOps.hpp>
+#include <model/rock/crust/CrustSummaryProperties.hpp>
+#include <model/rock/crust/CrustSummaryPredicates.hpp>
+#include <model/rock/crust/EmptyCrustField.hpp>
+#include <model/rock/crust/IgneousCrustField.hpp>
+#include <model/rock/lithosphere/Lithosphere.hpp>
+#include <model/rock/lithosphere/LithosphereSummary.hpp>
+#include <model/rock/lithosphere/LithosphereSummarization.hpp>
+#include <model/rock/lithosphere/LithosphereReferenceFrames.hpp>
+#include <model/rock/lithosphere/LithosphereResamplingPlan.hpp>
+
+std::atomic<long> allocation_count(0);
+
+void* operator new(std::size_t size)
+{
+  allocation_count++;
+  if (void* pointer = std::malloc(size == 0? 1 : size))
+  {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+void operator delete(void* pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+int main() {
+
+  const int M(2);
+  const int F(5);
+
+  using mass = si::mass<float>;
+  using density = si::density<float>;
+  using length = si::length<float>;
+
+  using vec3 = glm::vec3;
+  using mat3 = glm::mat3;
+  using mat4 = glm::mat4;
+
+  using bools = std::vector<bool>;
+
+  using Grid = dymaxion::Grid<std::int8_t, int, float>;
+
+  using Minerals = std::array<rock::Mineral,M>;
+
+  length meter(si::meter);
+
+  length world_radius(6.371e6 * si::meter);
+  density mantle_density(3000.0*si::kilogram/si::meter3);
+  int vertices_per_fine_square_side(30);
+  dymaxion::GridCache fine(Grid(world_radius/meter, vertices_per_fine_square_side));
+
+  iterated::Identity copy;
+
+  // GENERATE THE CRUST
+  rock::EarthlikeIgneousFormationGeneration earthlike(fine, world_radius/2.0f, 0.5f, 10);
+  auto generation = earthlike(12.0f, 1.1e4f);
+  rock::StratumStore<M> empty_stratum;
+  rock::Formation<M> empty_formation(fine.vertex_count(), empty_stratum);
+  rock::Formation<M> igneous_formation(fine.vertex_count());
+  rock::EmptyCrustField empty_crust;
+  copy(generation, igneous_formation);
+  rock::Crust<M,F> crust{empty_formation, empty_formation, empty_formation, igneous_formation, empty_formation};
+
+  auto age_of_world = 0.0f*si::megayear;
+  std::array<relation::PolynomialRailyardRelation<si::time<double>,si::density<double>,0,1>, 2> densities_for_age {
+    relation::get_linear_interpolation_function(si::megayear, si::kilogram/si::meter3, {0.0, 250.0}, {2890.0, 3300.0}), // Carlson & Raskin 1984
+    relation::get_linear_interpolation_function(si::megayear, si::kilogram/si::meter3, {0.0, 250.0}, {2600.0, 2600.0})
+  };
+
+  rock::CrustSummaryOps crust_summary_ops{
+    rock::ColumnSummaryOps{
+      length(si::centimeter)
+    }
+  };
+
+  rock::CrustOps<M> crust_ops;
+
+  rock::CrustSummaryProperty displacements{rock::ColumnSummaryIsostaticDisplacement(density(3300.0*si::kilogram/si::meter3))};
+
+  auto crust_summarize =
+    rock::crust_summarization<M,F>(
+      rock::formation_summarization<2>(
+        rock::stratum_summarization<2>(
+          rock::AgedStratumDensity{densities_for_age, age_of_world},
+          mass(0.0*si::tonne)
+        ),
+        meter
+      ), crust_summary_ops);
+  auto summarization = rock::lithosphere_summarization<M,F>(crust_summarize, crust_summary_ops);
+
+  rock::CrustSummary crust_summary(fine.vertex_count());
+  rock::FormationSummary formation_summary(fine.vertex_count());
+  crust_summarize(fine, 1, crust, crust_summary, formation_summary);
+
+  // assign each plate a hemisphere so that plates overlap, rift, and detach
+  const int P = 8; // plate count
+  auto plates = rock::Lithosphere<M,F>(P, crust);
+  bools hemisphere(fine.vertex_count());
+  std::vector<vec3> angular_velocities_in_seconds(P);
+  for (int i = 0; i < P; ++i)
+  {
+    vec3 pole = glm::normalize(vec3(std::cos(float(i)), std::sin(float(i)), float(i%3)-1.0f));
+    for (int j = 0; j < fine.vertex_count(); ++j)
+    {
+      hemisphere[j] = glm::dot(fine.vertex_position(j), pole) > 0.0f;
+    }
+    crust_ops.ternary(fine, hemisphere, plates[i], empty_crust, plates[i]);
+    angular_velocities_in_seconds[i] = 1e-15f * glm::cross(pole, vec3(0,0,1));
+  }
+
+  auto locals = rock::LithosphereSummary(P, crust_summary);
+  auto globals = rock::LithosphereSummary(P, crust_summary);
+  rock::CrustSummary master(fine.vertex_count());
+  std::vector<rock::CrustSummary> localized(P, crust_summary);
+  rock::FormationSummary scratch(fine.vertex_count());
+  rock::Crust<M,F> absorbed(plates[0]);
+  rock::CrustOpsScratch<M> crust_scratch(fine.vertex_count());
+  bools ownable(fine.vertex_count());
+  bools top(fine.vertex_count());
+  bools below(fine.vertex_count());
+  bools foundering(fine.vertex_count());
+  bools exists(fine.vertex_count());
+  bools rifting(fine.vertex_count());
+  bools accompanied(fine.vertex_count());
+  bools detaching(fine.vertex_count());
+  bools bools_scratch(fine.vertex_count());
+  unlayered::PackedMorphologyScratch morphology_scratch(fine.vertex_count());
+  std::vector<length> lengths_i(fine.vertex_count());
+  std::vector<float> buffer_scalars2_i(fine.vertex_count());
+  std::vector<std::uint8_t> buffer_exists_i(fine.vertex_count(), std::uint8_t(1));
+  std::vector<mat3> orientations(P, mat3(1));
+
+  iterated::Arithmetic arithmetic{adapted::SymbolicArithmetic{}};
+  aggregated::Order order{adapted::SymbolicOrder{}};
+
+  auto frames = rock::lithosphere_reference_frames<int,float,mat3>(
+    dymaxion::NearestVertexId<std::int8_t,int,float>(fine.grid),
+    fine.vertex_positions
+  );
+  auto plan = rock::lithosphere_resampling_plan<int,float,mat3>(fine, fine.vertex_positions, 1e-6f, 0.1f);
+
+  iterated::Bitset<adapted::BooleanBitset> bitset;
+  unlayered::PackedMorphology morphology;
+  rock::CrustSummaryPredicates predicates{morphology, bitset};
+
+  const float pi(3.1415926535);
+  const float oo(std::numeric_limits<float>::max());
+
+  auto step = [&]() {
+
+    // motion
+    for (std::size_t i(0); i < P; ++i)
+    {
+      orientations[i] =
+        glm::rotate(
+          mat4(orientations[i]),
+          float(si::kiloyear/si::second) * 2.0f*pi * glm::length(angular_velocities_in_seconds[i]),
+          glm::normalize(angular_velocities_in_seconds[i]));
+    }
+
+    // summarize
+    summarization .summarize (fine, plates, locals, scratch);
+    plan          .update    (orientations);
+    frames        .globalize (plan,         locals, globals);
+    summarization .flatten   (globals,      master);
+    frames        .localize  (plan,         master, localized);
+
+    const si::length<double> average_crust_thickness(7.1*si::kilometer); // McKenzie and O'nions 1992
+    const si::density<double> average_crust_density(2890.0*si::kilogram/si::meter3); // Carlson and Raskin 1984
+    rock::IgneousCrustField fresh_crust(
+      rock::FormationField(
+        field::uniform(
+          rock::Stratum<M>(
+            age_of_world,
+            age_of_world,
+            Minerals{
+              rock::Mineral(
+                average_crust_density * average_crust_thickness * si::meter * si::meter,
+                0, int(rock::GrainType::unweathered_extrusive)), // mafic
+              rock::Mineral(0.0*si::kilogram, 0) // felsic
+            }
+          ))));
+
+    // rifting and subduction
+    for (std::size_t i(0); i < P; ++i)
+    {
+      predicates.exists(i, locals[i], exists);
+      predicates.foundering(mantle_density, locals[i], foundering);
+      predicates.ownable(i, localized[i], ownable);
+      predicates.rifting(fine, ownable, exists, rifting, bools_scratch, morphology_scratch);
+      predicates.top(i, localized[i], top);
+      predicates.below(i, localized[i], below);
+      predicates.accompanied(i, mantle_density, localized[i], accompanied);
+      predicates.detaching(fine, accompanied, below, foundering, exists, detaching, bools_scratch, morphology_scratch);
+
+      crust_ops.ternary(fine, rifting, fresh_crust, plates[i], plates[i]);
+      crust_ops.ternary(fine, detaching, empty_crust, plates[i], plates[i]);
+
+      copy(exists, buffer_exists_i);
+
+      displacements(locals[i], lengths_i);
+      arithmetic.divide(lengths_i, procedural::uniform(length(si::kilometer)), buffer_scalars2_i);
+      order.min(buffer_scalars2_i, oo);
+      order.max(buffer_scalars2_i,-oo);
+    }
+
+    // not called by 6-interaction, but included so that `CrustOps` is covered by the harness
+    crust_ops.absorb(plates[0], plates[1], absorbed, crust_scratch);
+  };
+
+  const int warmup_step_count(2);
+  const int step_count(5);
+  for (int i = 0; i < warmup_step_count; ++i)
+  {
+    step();
+  }
+
+  allocation_count = 0;
+  for (int i = 0; i < step_count; ++i)
+  {
+    step();
+  }
+  long steady_state_allocation_count = allocation_count;
+
+  std::cout << "heap allocations over " << step_count << " steady-state steps: " << steady_state_allocation_count << std::endl;
+  return steady_state_allocation_count == 0? 0 : 1;
+}
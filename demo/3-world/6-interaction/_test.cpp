@@ -67,6 +67,7 @@ and gprof can't run on output using the -fopenmp flag and still provide accurate
 #include <raster/unlayered/NeighborBasedFloodFilling.hpp> // unlayered::NeighborBasedFloodFilling
 #include <raster/spheroidal/Strings.hpp>            // spheroidal::Strings
 #include <raster/unlayered/Morphology.hpp>          // unlayered::Morphology
+#include <raster/unlayered/PackedMorphology.hpp>    // unlayered::PackedMorphology, unlayered::PackedMorphologyScratch
 
 #include <model/rock/mineral/GrainType.hpp>
 #include <model/rock/column/ColumnSummaryProperties.hpp>
@@ -93,6 +94,7 @@ and gprof can't run on output using the -fopenmp flag and still provide accurate
 #include <model/rock/lithosphere/LithosphereSummary.hpp>
 #include <model/rock/lithosphere/LithosphereSummarization.hpp>
 #include <model/rock/lithosphere/LithosphereReferenceFrames.hpp>
+#include <model/rock/lithosphere/LithosphereResamplingPlan.hpp>
 
 #include <update/OrbitalNavigationState.hpp>           
 #include <update/OrbitalNavigationUpdater.hpp>         
@@ -272,7 +274,7 @@ int main(int argc, char *argv[]) {
   // CALCULATE STRESS
   unlayered::VectorCalculusByFundamentalTheorem calculus;
   std::vector<vec3> vertex_gradient(coarse.vertex_count());
-  calculus.gradient(coarse.grid, coarse_buoyancy_pressure_in_pascals, vertex_gradient);
+  calculus.gradient(coarse, coarse_buoyancy_pressure_in_pascals, vertex_gradient);
 
   // FRACTURE
   const int P = 8; // plate count
@@ -296,6 +298,7 @@ int main(int argc, char *argv[]) {
   bools accompanied(fine.vertex_count());
   bools detaching(fine.vertex_count());
   bools bools_scratch(fine.vertex_count());
+  unlayered::PackedMorphologyScratch morphology_scratch(fine.vertex_count());
 
   // GENERATE PLATE MAP FROM FRACTURE STATES
   std::vector<int> coarse_plate_map(coarse.vertex_count());
@@ -426,9 +429,15 @@ int main(int argc, char *argv[]) {
     dymaxion::NearestVertexId<std::int8_t,int,float>(fine.grid),
     fine.vertex_positions // vertex_positions is traversed in-order so it's faster to use a cache
   );
+  auto plan = rock::lithosphere_resampling_plan<int,float,mat3>(
+    fine, 
+    fine.vertex_positions, // vertex_positions is traversed out-of-order while walking so it's faster to use a cache
+    1e-6f,                 // rotations that change less than this reuse the ids of the previous frame
+    0.1f                   // rotations that change less than this walk from the ids of the previous frame
+  );
 
   iterated::Bitset<adapted::BooleanBitset> bitset;
-  unlayered::Morphology morphology{bitset};
+  unlayered::PackedMorphology morphology;
   rock::CrustSummaryPredicates predicates{morphology, bitset};
 
   const float pi(3.1415926535);
@@ -469,9 +478,10 @@ int main(int argc, char *argv[]) {
 
       // summarize
       summarization .summarize (fine, plates, locals, scratch);   // summarize each plate into a (e.g.) CrustSummary raster
-      frames        .globalize (orientations, locals, globals);   // resample plate-specific rasters onto a global grid
+      plan          .update    (orientations);                    // find the ids that are needed to resample each plate
+      frames        .globalize (plan,         locals, globals);   // resample plate-specific rasters onto a global grid
       summarization .flatten   (globals,      master);            // condense globalized rasters into e.g. LithosphereSummary
-      frames        .localize  (orientations, master, localized); // resample global raster to a plate-specific for each plate
+      frames        .localize  (plan,         master, localized); // resample global raster to a plate-specific for each plate
       // summarization uses fine only for vertex_dual_areas, so it's faster if fine is a GridCache
 
       const si::length<double> average_crust_thickness(7.1*si::kilometer); // McKenzie and O'nions 1992
@@ -501,11 +511,11 @@ int main(int argc, char *argv[]) {
         predicates.exists(i, locals[i], exists); 
         predicates.foundering(mantle_density, locals[i], foundering);
         predicates.ownable(i, localized[i], ownable);
-        predicates.rifting(fine, ownable, exists, rifting, bools_scratch);
+        predicates.rifting(fine, ownable, exists, rifting, bools_scratch, morphology_scratch);
         predicates.top(i, localized[i], top);
         predicates.below(i, localized[i], below);
         predicates.accompanied(i, mantle_density, localized[i], accompanied);
-        predicates.detaching(fine, accompanied, below, foundering, exists, detaching, bools_scratch);
+        predicates.detaching(fine, accompanied, below, foundering, exists, detaching, bools_scratch, morphology_scratch);
 
         // // apply rifting and subduction
         crust_ops.ternary(fine, rifting, fresh_crust, plates[i], plates[i]);
@@ -3,6 +3,7 @@
 // C libraries
 
 // std libraries
+#include <cstddef> // std::size_t
 
 // 3rd party libraries
 #include <glm/matrix.hpp>
@@ -30,6 +31,21 @@ namespace field
 		{
 			return f(g(V));
 		}
+
+		/*
+		`operator()(positions, out, intermediate, scratch...)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position,
+		where `g` is evaluated into the raster `intermediate` using its own batched method, 
+		such as `FractalBrownianNoise::operator()(positions, out, scratch)`, to which `scratch...` is passed.
+		*/
+		template<typename Positions, typename Out, typename Intermediate, typename... Scratch>
+		void operator()(const Positions& positions, Out& out, Intermediate& intermediate, Scratch&... scratch) const
+		{
+			g(positions, intermediate, scratch...);
+			for (std::size_t i = 0; i < positions.size(); ++i)
+			{
+				out[i] = f(intermediate[i]);
+			}
+		}
 	};
 
 	/*
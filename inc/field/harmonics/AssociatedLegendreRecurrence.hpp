@@ -0,0 +1,100 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::sqrt
+
+// std libraries
+#include <algorithm> // std::max
+#include <vector>    // std::vector
+
+namespace field {
+
+    /*
+    `AssociatedLegendreRecurrence<T>` evaluates every 4π-normalized associated Legendre polynomial Pₗₘ(z)
+    for 0≤m≤l≤Lhi in a single sweep, where Pₗₘ is defined as in `field::SphericalHarmonic<T,M,L>`.
+    It uses the following recurrences, whose coefficients are precomputed once for a given Lhi:
+
+        P₀₀ = 1
+        P₁₁ = √3 √(1-z²)
+        Pₘₘ = √((2m+1)/(2m)) √(1-z²) Pₘ₋₁,ₘ₋₁             for m≥2
+        Pₘ₊₁,ₘ = √(2m+3) z Pₘₘ
+        Pₗₘ = aₗₘ z Pₗ₋₁,ₘ - bₗₘ Pₗ₋₂,ₘ                     for l≥m+2
+
+        aₗₘ = √((2l-1)(2l+1) / ((l-m)(l+m)))
+        bₗₘ = √((2l+1)(l+m-1)(l-m-1) / ((l-m)(l+m)(2l-3)))
+
+    Unlike the explicit polynomials of `SphericalHarmonic`, these recurrences remain stable to degrees in the hundreds.
+    Values are stored in a triangular array that is indexed by `id(l,m)`.
+    */
+    template<typename T>
+    struct AssociatedLegendreRecurrence
+    {
+        int Lhi;
+        std::vector<T> a;
+        std::vector<T> b;
+        // `diagonal[m]` is the ratio Pₘₘ/(√(1-z²) Pₘ₋₁,ₘ₋₁), and `subdiagonal[m]` is the ratio Pₘ₊₁,ₘ/(z Pₘₘ)
+        std::vector<T> diagonal;
+        std::vector<T> subdiagonal;
+
+        explicit AssociatedLegendreRecurrence(const int Lhi):
+            Lhi(Lhi),
+            a(size(), T(0)),
+            b(size(), T(0)),
+            diagonal(Lhi+1, T(1)),
+            subdiagonal(Lhi+1, T(0))
+        {
+            for (int m = 0; m <= Lhi; ++m)
+            {
+                diagonal[m] = m==0? T(1) : m==1? std::sqrt(T(3)) : std::sqrt(T(2*m+1)/T(2*m));
+                subdiagonal[m] = std::sqrt(T(2*m+3));
+            }
+            for (int m = 0; m <= Lhi; ++m)
+            {
+                for (int l = m+2; l <= Lhi; ++l)
+                {
+                    a[id(l,m)] = std::sqrt(T((2*l-1)*(2*l+1)) / T((l-m)*(l+m)));
+                    b[id(l,m)] = std::sqrt(T(2*l+1)*T(l+m-1)*T(l-m-1) / (T(l-m)*T(l+m)*T(2*l-3)));
+                }
+            }
+        }
+
+        static constexpr inline int id(const int l, const int m)
+        {
+            return l*(l+1)/2 + m;
+        }
+
+        // the number of polynomials that are evaluated, (Lhi+1)(Lhi+2)/2
+        inline int size() const
+        {
+            return id(Lhi+1, 0);
+        }
+
+        /*
+        `operator()` stores Pₗₘ(z) in `out[id(l,m)]` for each 0≤m≤l≤Lhi,
+        where `out` must be able to store `size()` values
+        */
+        template<typename Out>
+        void operator()(const T z, Out& out) const
+        {
+            const T s(std::sqrt(std::max(T(0), T(1)-z*z)));
+            T Pmm(1);
+            for (int m = 0; m <= Lhi; ++m)
+            {
+                if (m >= 1)
+                {
+                    Pmm *= diagonal[m] * s;
+                }
+                out[id(m,m)] = Pmm;
+                if (m+1 <= Lhi)
+                {
+                    out[id(m+1,m)] = subdiagonal[m] * z * Pmm;
+                }
+                for (int l = m+2; l <= Lhi; ++l)
+                {
+                    out[id(l,m)] = a[id(l,m)] * z * out[id(l-1,m)] - b[id(l,m)] * out[id(l-2,m)];
+                }
+            }
+        }
+    };
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::sqrt
+
+namespace field {
+
+    /*
+    `AzimuthRecurrence<T>` stores cos(mϕ) and sin(mϕ) for an order m that starts at 0,
+    and `next()` advances them to the order m+1 by angle addition from cos(ϕ) and sin(ϕ):
+
+        cos((m+1)ϕ) = cos(mϕ)cos(ϕ) - sin(mϕ)sin(ϕ)
+        sin((m+1)ϕ) = sin(mϕ)cos(ϕ) + cos(mϕ)sin(ϕ)
+
+    so that every order of a spherical harmonic may be visited without calling a trigonometric function.
+    */
+    template<typename T>
+    struct AzimuthRecurrence
+    {
+        T cos_phi;
+        T sin_phi;
+        T cos_mphi;
+        T sin_mphi;
+
+        AzimuthRecurrence(const T cos_phi, const T sin_phi):
+            cos_phi(cos_phi),
+            sin_phi(sin_phi),
+            cos_mphi(1),
+            sin_mphi(0)
+        {}
+
+        inline void next()
+        {
+            const T cos_next(cos_mphi*cos_phi - sin_mphi*sin_phi);
+            sin_mphi = sin_mphi*cos_phi + cos_mphi*sin_phi;
+            cos_mphi = cos_next;
+        }
+    };
+
+    /*
+    `azimuth` stores cos(ϕ) and sin(ϕ) for the azimuth ϕ of a normalized vector `u`,
+    or cos(ϕ)=1 and sin(ϕ)=0 if `u` lies on the polar axis, where ϕ is undefined
+    */
+    template<typename T, typename V>
+    inline void azimuth(const V& u, T& cos_phi, T& sin_phi)
+    {
+        const T rho(std::sqrt(u.x*u.x + u.y*u.y));
+        cos_phi = rho > T(0)? u.x/rho : T(1);
+        sin_phi = rho > T(0)? u.y/rho : T(0);
+    }
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+// in-house libraries
+#include "AssociatedLegendreRecurrence.hpp"
+#include "AzimuthRecurrence.hpp"
+
+namespace field {
+
+    /*
+    `harmonic_coefficient_id` returns the index of the coefficient of Yₗₘ within a flat array of coefficients,
+    as used by `SphericalHarmonics`, `RuntimeSphericalHarmonics`, and `spheroidal::HarmonicTransform`
+    */
+    constexpr inline int harmonic_coefficient_id(const int M, const int L)
+    {
+        return L*L + M+L;
+    }
+
+    /*
+    `harmonic_series` returns Σᴸₗ₌₀Σˡₘ₌₋ₗ fₗₘYₗₘ(z,ϕ) at a point, where:
+    * `legendre_values` stores every Pₗₘ(z) of the point, as found by `legendre`
+    * `coefficients` stores every fₗₘ, indexed by `harmonic_coefficient_id(M,L)`
+    * `azimuth` starts at the order 0 for the ϕ of the point
+    */
+    template<typename T, typename LegendreValues, typename Coefficients>
+    T harmonic_series(
+        const AssociatedLegendreRecurrence<T>& legendre,
+        const LegendreValues& legendre_values,
+        const Coefficients& coefficients,
+        AzimuthRecurrence<T> azimuth
+    ) {
+        const int Lhi(legendre.Lhi);
+        T f(0);
+        for (int m = 0; m <= Lhi; ++m)
+        {
+            T cos_sum(0);
+            T sin_sum(0);
+            for (int l = m; l <= Lhi; ++l)
+            {
+                const T P(legendre_values[legendre.id(l,m)]);
+                cos_sum += coefficients[harmonic_coefficient_id(m,l)] * P;
+                if (m > 0)
+                {
+                    sin_sum += coefficients[harmonic_coefficient_id(-m,l)] * P;
+                }
+            }
+            f += cos_sum*azimuth.cos_mphi + sin_sum*azimuth.sin_mphi;
+            azimuth.next();
+        }
+        return f;
+    }
+
+    /*
+    `accumulate_harmonics` adds f Yₗₘ(z,ϕ) at a point to `inout[harmonic_coefficient_id(M,L)]` for every degree and order,
+    where `legendre_values` and `azimuth` are as described for `harmonic_series`
+    */
+    template<typename T, typename LegendreValues, typename InOut>
+    void accumulate_harmonics(
+        const AssociatedLegendreRecurrence<T>& legendre,
+        const LegendreValues& legendre_values,
+        AzimuthRecurrence<T> azimuth,
+        const T f,
+        InOut& inout
+    ) {
+        const int Lhi(legendre.Lhi);
+        for (int m = 0; m <= Lhi; ++m)
+        {
+            const T fcos(f*azimuth.cos_mphi);
+            const T fsin(f*azimuth.sin_mphi);
+            for (int l = m; l <= Lhi; ++l)
+            {
+                const T P(legendre_values[legendre.id(l,m)]);
+                inout[harmonic_coefficient_id(m,l)] += fcos * P;
+                if (m > 0)
+                {
+                    inout[harmonic_coefficient_id(-m,l)] += fsin * P;
+                }
+            }
+            azimuth.next();
+        }
+    }
+
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::cos, std::sin
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+
+// std libraries
+#include <vector>    // std::vector
+
+// 3rd party libraries
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include <field/harmonics/AssociatedLegendreRecurrence.hpp> // field::AssociatedLegendreRecurrence
+#include <field/harmonics/AzimuthRecurrence.hpp>            // field::AzimuthRecurrence, field::azimuth
+#include <field/harmonics/HarmonicSeries.hpp>               // field::harmonic_series, field::accumulate_harmonics
+
+namespace field
+{
+
+	/*
+	`RuntimeSphericalHarmonics<T>` is a field that represents the same function as `SphericalHarmonics<T,Lhi>`:
+
+        f(z,ϕ) = Σᴸₗ₌₀Σˡₘ₌₋ₗ fₗₘYₗₘ(z,ϕ)
+
+    but where `Lhi` is chosen at runtime, so that compilation time does not grow with `Lhi`.
+    Coefficients are stored in a flat array that is indexed by `coefficient_id(M,L)`, like that of `SphericalHarmonics`.
+
+    Every Pₗₘ(z) of a point is found in a single sweep of `AssociatedLegendreRecurrence`, whose tables are precomputed on construction,
+    and cos(mϕ) and sin(mϕ) are found for each order by `AzimuthRecurrence`.
+    Sums over degrees and orders are shared with `spheroidal::HarmonicTransform`, see `harmonic_series` and `accumulate_harmonics`.
+    Methods that evaluate a single point allocate a scratch array of (Lhi+1)(Lhi+2)/2 values.
+    The batched method, `operator()(positions, out)`, instead allocates one scratch array per thread,
+    and distributes positions across OpenMP threads when compiled with `-fopenmp`.
+	*/
+	template<typename T>
+	class RuntimeSphericalHarmonics
+	{
+
+		AssociatedLegendreRecurrence<T> legendre;
+		std::vector<T> coefficients;
+
+	public:
+
+		using value_type = T;
+
+		template<typename Coefficients>
+		RuntimeSphericalHarmonics(const int Lhi, const Coefficients& coefficients):
+			legendre(Lhi),
+			coefficients(coefficients.begin(), coefficients.end())
+		{}
+
+		inline int degree() const
+		{
+			return legendre.Lhi;
+		}
+
+		inline int coefficient_count() const
+		{
+			return (legendre.Lhi+1)*(legendre.Lhi+1);
+		}
+
+		static constexpr inline int coefficient_id(const int M, const int L)
+		{
+			return harmonic_coefficient_id(M,L);
+		}
+
+		/*
+		`call` returns f(z,ϕ) given cos(ϕ) and sin(ϕ),
+		where `legendre_values` is scratch that must be able to store (Lhi+1)(Lhi+2)/2 values
+		*/
+		template<typename Scratch>
+		T call(const T z, const T cos_phi, const T sin_phi, Scratch& legendre_values) const
+		{
+			legendre(z, legendre_values);
+			return harmonic_series(legendre, legendre_values, coefficients, AzimuthRecurrence<T>(cos_phi, sin_phi));
+		}
+
+		/*
+		`basis` stores Yₗₘ(z,ϕ) in `out[coefficient_id(M,L)]` for every degree and order at the position of a vector,
+		where `out` must be able to store `coefficient_count()` values
+		*/
+		template<int N, typename T2, glm::qualifier Q, typename Out>
+		void basis(const glm::vec<N,T2,Q>& v, Out& out) const
+		{
+			const auto u(glm::normalize(v));
+			T cos_phi, sin_phi;
+			azimuth(u, cos_phi, sin_phi);
+			std::vector<T> legendre_values(legendre.size());
+			legendre(T(u.z), legendre_values);
+			for (int i = 0; i < coefficient_count(); ++i)
+			{
+				out[i] = T(0);
+			}
+			accumulate_harmonics(legendre, legendre_values, AzimuthRecurrence<T>(cos_phi, sin_phi), T(1), out);
+		}
+
+		inline T operator()(const T z, const T phi) const
+		{
+			std::vector<T> legendre_values(legendre.size());
+			return call(z, std::cos(phi), std::sin(phi), legendre_values);
+		}
+
+		inline T operator()(const T x, const T y, const T z) const
+		{
+			return (*this)(glm::vec<3,T,glm::defaultp>(x,y,z));
+		}
+
+		template<int N, typename T2, glm::qualifier Q=glm::defaultp>
+		[[nodiscard]] inline T operator()(const glm::vec<N,T2,Q>& v) const
+		{
+			const auto u(glm::normalize(v));
+			T cos_phi, sin_phi;
+			azimuth(u, cos_phi, sin_phi);
+			std::vector<T> legendre_values(legendre.size());
+			return call(T(u.z), cos_phi, sin_phi, legendre_values);
+		}
+
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const
+		{
+			const std::ptrdiff_t count(positions.size());
+			#ifdef _OPENMP
+			#pragma omp parallel
+			#endif
+			{
+				std::vector<T> legendre_values(legendre.size());
+				#ifdef _OPENMP
+				#pragma omp for
+				#endif
+				for (std::ptrdiff_t i = 0; i < count; ++i)
+				{
+					const auto u(glm::normalize(positions[i]));
+					T cos_phi, sin_phi;
+					azimuth(u, cos_phi, sin_phi);
+					out[i] = call(T(u.z), cos_phi, sin_phi, legendre_values);
+				}
+			}
+		}
+
+	};
+
+	template<typename T, typename Coefficients>
+	inline auto runtime_spherical_harmonics(const int Lhi, const Coefficients& coefficients)
+	{
+		return RuntimeSphericalHarmonics<T>(Lhi, coefficients);
+	}
+
+}
@@ -0,0 +1,73 @@
+
+// std libraries
+#include <array>    // std::array
+#include <cmath>    // std::abs, std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "SphericalHarmonics.hpp"
+#include "RuntimeSphericalHarmonics.hpp"
+
+TEST_CASE( "RuntimeSphericalHarmonics agreement with SphericalHarmonics", "[field]" ) {
+
+    const int Lhi(8);
+    std::array<double,(Lhi+1)*(Lhi+1)> coefficients;
+    for (std::size_t i = 0; i < coefficients.size(); ++i)
+    {
+        coefficients[i] = std::sin(double(7*i+1));
+    }
+    field::SphericalHarmonics<double,Lhi> unrolled(coefficients);
+    auto runtime = field::runtime_spherical_harmonics<double>(Lhi, coefficients);
+
+    std::vector<glm::dvec3> positions;
+    for (int i = 0; i < 200; ++i)
+    {
+        positions.push_back(glm::dvec3(std::sin(1.1*i), std::sin(2.3*i+0.5), std::sin(3.7*i+1.0)));
+    }
+    positions.push_back(glm::dvec3(0,0,1));
+    positions.push_back(glm::dvec3(0,0,-2));
+
+    SECTION("RuntimeSphericalHarmonics(…) must produce the same values as SphericalHarmonics(…)"){
+        double max_error(0.0);
+        for (const auto& position : positions)
+        {
+            max_error = std::max(max_error, std::abs(runtime(position) - unrolled(position)));
+        }
+        CHECK(max_error < 1e-10);
+    }
+
+    SECTION("RuntimeSphericalHarmonics(positions, out) must produce the same values as RuntimeSphericalHarmonics(…)"){
+        std::vector<double> out(positions.size());
+        runtime(positions, out);
+        double max_error(0.0);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            max_error = std::max(max_error, std::abs(out[i] - runtime(positions[i])));
+        }
+        CHECK(max_error < 1e-12);
+    }
+
+    SECTION("RuntimeSphericalHarmonics::basis(…) must produce values whose linear combination is RuntimeSphericalHarmonics(…)"){
+        std::vector<double> basis(runtime.coefficient_count());
+        double max_error(0.0);
+        for (const auto& position : positions)
+        {
+            runtime.basis(position, basis);
+            double sum(0.0);
+            for (int i = 0; i < runtime.coefficient_count(); ++i)
+            {
+                sum += coefficients[i] * basis[i];
+            }
+            max_error = std::max(max_error, std::abs(sum - runtime(position)));
+        }
+        CHECK(max_error < 1e-10);
+    }
+
+}
@@ -54,10 +54,10 @@ namespace field {
                 std::sqrt(
                     T(2-(lMl==0)) *
                     T(2*L+1) *
-                    combinatoric::factorial(L-lMl) / 
-                    combinatoric::factorial(L+lMl)
+                    combinatoric::factorial(T(L-lMl)) / 
+                    combinatoric::factorial(T(L+lMl))
                 ) * 
-                std::sqrt(std::pow(T(1 - std::clamp(z*z,T(0),T(1))), T(lMl)/T(2))) * 
+                std::pow(T(1 - std::clamp(z*z,T(0),T(1))), T(lMl)/T(2)) * 
                 analytic::polynomial(
                     analytic::higher_order_derivative<lMl>(
                         analytic::legendre_polynomial<T,L>())
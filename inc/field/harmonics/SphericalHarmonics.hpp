@@ -37,7 +37,7 @@ namespace field
 
         constexpr int coefficient_id(const int M, const int L) const
         {
-            return (L-1)*(L-1) + M+L;
+            return L*L + M+L;
         }
 
         // Σₘ₌ₗ⁻ˡ Yₗₘ(z,ϕ)
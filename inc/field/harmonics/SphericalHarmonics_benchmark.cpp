@@ -0,0 +1,94 @@
+
+// C libraries
+#include <cmath>    // std::abs, std::sin
+
+// std libraries
+#include <algorithm> // std::max
+#include <array>    // std::array
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include <grid/dymaxion/Grid.hpp>
+#include <grid/dymaxion/GridCache.hpp>
+
+#include "SphericalHarmonics.hpp"
+#include "RuntimeSphericalHarmonics.hpp"
+
+/*
+`SphericalHarmonics_benchmark.cpp` reports the runtime of evaluating `SphericalHarmonics<T,Lhi>`
+and `RuntimeSphericalHarmonics<T>` over the vertices of a grid for several degrees,
+alongside the speedup of `RuntimeSphericalHarmonics` and the largest difference between the two.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`, but note that compiling `SphericalHarmonics<T,64>` takes several minutes,
+and that each of its evaluations takes over a minute on a single core.
+Differences at high degree reflect the error of `SphericalHarmonics`,
+whose explicit Legendre polynomials suffer from catastrophic cancellation.
+*/
+
+template<typename F>
+double seconds_for(const int repetition_count, const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetition_count; ++i)
+    {
+        f();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end-start).count() / repetition_count;
+}
+
+template<int Lhi>
+void benchmark(const std::vector<glm::dvec3>& positions, const int repetition_count)
+{
+    std::array<double,(Lhi+1)*(Lhi+1)> coefficients;
+    for (std::size_t i = 0; i < coefficients.size(); ++i)
+    {
+        coefficients[i] = std::sin(double(7*i+1)) / double(coefficients.size());
+    }
+    field::SphericalHarmonics<double,Lhi> unrolled(coefficients);
+    auto runtime = field::runtime_spherical_harmonics<double>(Lhi, coefficients);
+
+    std::vector<double> unrolled_out(positions.size());
+    std::vector<double> runtime_out(positions.size());
+    const double unrolled_seconds = seconds_for(repetition_count, [&](){
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            unrolled_out[i] = unrolled(positions[i]);
+        }
+    });
+    const double runtime_seconds = seconds_for(repetition_count, [&](){
+        runtime(positions, runtime_out);
+    });
+    double max_difference(0.0);
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        max_difference = std::max(max_difference, std::abs(unrolled_out[i] - runtime_out[i]));
+    }
+    std::cout
+        << Lhi << "\t" << positions.size() << "\t" << unrolled_seconds << "\t" << runtime_seconds << "\t"
+        << unrolled_seconds/runtime_seconds << "\t" << max_difference << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    using Grid = dymaxion::Grid<int,int,double>;
+
+    const int vertices_per_square_side(argc > 1? std::stoi(argv[1]) : 16);
+    const int repetition_count(argc > 2? std::stoi(argv[2]) : 1);
+
+    dymaxion::GridCache grid(Grid(1.0, vertices_per_square_side));
+
+    std::cout << "Lhi\tpositions\tSphericalHarmonics seconds\tRuntimeSphericalHarmonics seconds\tspeedup\tmax difference" << std::endl;
+    benchmark<4>(grid.vertex_positions, repetition_count);
+    benchmark<16>(grid.vertex_positions, repetition_count);
+    benchmark<64>(grid.vertex_positions, repetition_count);
+
+    return 0;
+}
@@ -25,6 +25,8 @@ namespace field
     `RegionThreshold` and `RegionCenters` may be any container that contains scalars and vectors (respectively),
     but for data locality concerns, we highly recommend using `procedural::UnitIntervalNoise<scalar>` 
     and `procedural::NormalizedVectorInterleave<Noise<scalar>>`.
+    NOTE: thresholds are currently disabled below, so every region reaches every point.
+    See `SphericalCapNoise` for a variant that uses thresholds, and so differs in output, but visits only the regions that reach a point.
 	*/
 	template<typename T, typename RegionThreshold, typename RegionCenter>
 	struct EliasNoise
@@ -4,6 +4,7 @@
 
 // std libraries
 #include <iostream>
+#include <vector>
 
 // 3rd party libraries
 
@@ -12,6 +13,21 @@
 namespace field
 {
 
+	/*
+	`FractalBrownianNoiseScratch` stores the positions and values of a single octave for `FractalBrownianNoise::operator()(positions, out, scratch)`.
+	It is owned by the caller so that it may be reused between calls on rasters of the same size.
+	*/
+	template<typename vector, typename scalar>
+	struct FractalBrownianNoiseScratch
+	{
+		std::vector<vector> positions;
+		std::vector<scalar> octave;
+		explicit FractalBrownianNoiseScratch(const std::size_t vertex_count):
+			positions(vertex_count),
+			octave(vertex_count)
+		{}
+	};
+
 	template<typename id, typename scalar, typename Noise>
 	class FractalBrownianNoise
 	{
@@ -60,6 +76,38 @@ namespace field
 		    return output;
 		}
 
+		/*
+		`operator()(positions, out, scratch)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position, with identical results.
+		Each octave is passed to the batched method of `noise` as a whole raster, 
+		so `noise` must provide `operator()(positions, out)`, as do `ValueNoise`, `PerlinNoise`, etc.
+		The positions and values of each octave are stored in `scratch`, see `FractalBrownianNoiseScratch`,
+		which must be constructed for `positions.size()` vertices.
+		*/
+		template<typename Positions, typename Out, typename Scratch>
+		void operator()(const Positions& positions, Out& out, Scratch& scratch) const {
+			auto& position(scratch.positions);
+			auto& octave(scratch.octave);
+			for (std::size_t j = 0; j < positions.size(); ++j)
+			{
+				position[j] = coarsest_frequency*positions[j];
+			}
+			scalar amplitude(1);
+			noise(position, out);
+			for (id i = 0; i < octave_count; ++i)
+			{
+				amplitude *= amplitude_scale_per_frequency_doubling;
+				for (std::size_t j = 0; j < positions.size(); ++j)
+				{
+					position[j] *= scalar(2);
+				}
+				noise(position, octave);
+				for (std::size_t j = 0; j < positions.size(); ++j)
+				{
+					out[j] += amplitude*octave[j];
+				}
+			}
+		}
+
 	};
 
 	template<typename id, typename scalar, typename Noise>
@@ -0,0 +1,90 @@
+
+// std libraries
+#include <cmath>
+#include <vector>
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>     // *vec3
+
+// in-house libraries
+#include <math/analytic/Sum.hpp>
+#include <math/analytic/Gaussian.hpp>
+#include <grid/dymaxion/Grid.hpp>
+#include <grid/dymaxion/GridPyramid.hpp>
+
+#include "RankedFractalBrownianNoise.hpp"
+#include "FractalBrownianRasterization.hpp"
+
+TEST_CASE( "TabulatedFunction()", "[field]" ) {
+    auto cdf = analytic::Error(0.0, 1.0, 1.0/std::sqrt(2.0*3.141592653589793));
+    field::TabulatedFunction<double> table(cdf, -8.0, 8.0);
+
+    SECTION("TabulatedFunction(…) must approximate the function it tabulates"){
+        double max_error(0.0);
+        for (double x = -10.0; x < 10.0; x += 0.01)
+        {
+            max_error = std::max(max_error, std::abs(table(x) - cdf(x)));
+        }
+        CHECK(max_error < 1e-5);
+    }
+}
+
+TEST_CASE( "FractalBrownianRasterization()", "[field]" ) {
+    const double radius(2.0);
+    dymaxion::GridPyramid<int,int,double> pyramid(dymaxion::Grid<int,int,double>(radius, 32));
+    auto rfbn = field::ranked_fractal_brownian_noise<3>(6, 0.5, 2.0/radius, 12.0, 1.1e4);
+    std::vector<double> expected(pyramid[0].vertex_count());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        expected[i] = rfbn(pyramid[0].vertex_positions[i]);
+    }
+
+    SECTION("FractalBrownianRasterization(…) must match the equivalent noise to within the error of its CDF if no octave can be coarsened"){
+        auto rasterize = field::ranked_fractal_brownian_rasterization(rfbn, 1e6);
+        std::vector<double> out(expected.size());
+        rasterize(pyramid, out);
+        double max_error(0.0);
+        for (std::size_t i = 0; i < out.size(); ++i)
+        {
+            max_error = std::max(max_error, std::abs(out[i] - expected[i]));
+        }
+        CHECK(max_error < 1e-5);
+    }
+
+    SECTION("FractalBrownianRasterization(…) must evaluate coarse octaves on coarse levels"){
+        auto rasterize = field::ranked_fractal_brownian_rasterization(rfbn, 4.0);
+        CHECK(rasterize.octave_level(pyramid, 0) > 0);
+        CHECK(rasterize.octave_level(pyramid, 6) == 0);
+    }
+
+    SECTION("FractalBrownianRasterization(…) must approximate the equivalent noise if octaves are coarsened"){
+        auto rasterize = field::ranked_fractal_brownian_rasterization(rfbn, 4.0);
+        std::vector<double> out(expected.size());
+        rasterize(pyramid, out);
+        double total_error(0.0);
+        double max_error(0.0);
+        int out_of_range_count(0);
+        for (std::size_t i = 0; i < out.size(); ++i)
+        {
+            out_of_range_count += out[i] < 0.0 || 1.0 < out[i];
+            total_error += std::abs(out[i] - expected[i]);
+            max_error = std::max(max_error, std::abs(out[i] - expected[i]));
+        }
+        CHECK(out_of_range_count == 0);
+        CHECK(total_error / out.size() < 0.01);
+        CHECK(max_error < 0.1);
+    }
+
+    SECTION("FractalBrownianRasterization(…) must produce identical results when called repeatedly"){
+        auto rasterize = field::ranked_fractal_brownian_rasterization(rfbn, 4.0);
+        std::vector<double> first(expected.size());
+        std::vector<double> second(expected.size());
+        rasterize(pyramid, first);
+        rasterize(pyramid, second);
+        CHECK(first == second);
+    }
+}
+
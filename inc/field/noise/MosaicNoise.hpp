@@ -11,6 +11,8 @@
 
 #include <grid/cartesian/UnboundedIndexing.hpp>
 
+#include "NoiseBlocks.hpp"
+
 namespace field
 {
 
@@ -49,6 +51,21 @@ namespace field
 		    return noise(indexing.memory_id(V));
 		}
 
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position.
+		Blocks of positions are distributed across OpenMP threads, see `each_noise_block`,
+		but positions within a block are not vectorized, since each calls `noise`.
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const {
+			each_noise_block(positions.size(), [&](const std::size_t begin, const std::size_t end){
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					out[i] = noise(indexing.memory_id(positions[i]));
+				}
+			});
+		}
+
 	};
 
 	template<typename Noise>
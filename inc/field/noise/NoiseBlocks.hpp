@@ -0,0 +1,40 @@
+#pragma once
+
+// C libraries
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+
+// std libraries
+#include <algorithm> // std::min
+
+namespace field
+{
+
+	/*
+	`noise_block_size` is the number of positions that are visited together by the batched methods of noise,
+	such as `ValueNoise::operator()(positions, out)`.
+	Within a block, each step of a calculation is applied to every position before the next step begins,
+	so that compilers are free to vectorize steps across positions, and intermediate values of a block stay within cache.
+	*/
+	constexpr std::size_t noise_block_size = 64;
+
+	/*
+	`each_noise_block` calls `f(begin, end)` for consecutive blocks of ids that together cover [0, count).
+	Blocks are distributed across OpenMP threads when compiled with `-fopenmp`.
+	Each block is written to by exactly one call, so results do not depend on the number of threads.
+	*/
+	template<typename F>
+	void each_noise_block(const std::size_t count, const F& f)
+	{
+		const std::ptrdiff_t signed_count(count);
+		const std::ptrdiff_t block_size(noise_block_size);
+		#ifdef _OPENMP
+		#pragma omp parallel for schedule(static)
+		#endif
+		for (std::ptrdiff_t begin = 0; begin < signed_count; begin += block_size)
+		{
+			f(std::size_t(begin), std::size_t(std::min(begin + block_size, signed_count)));
+		}
+	}
+
+}
+
@@ -12,6 +12,8 @@
 // in-house libraries
 #include <grid/cartesian/OrthantIndexing.hpp>
 
+#include "NoiseBlocks.hpp"
+
 namespace field
 {
 
@@ -69,6 +71,54 @@ namespace field
 		    }
 		    return f / weight_total;
 		}
+
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position, with identical results.
+		Within each block of positions, see `noise_block_size`, corners are visited in the outer loop and positions in the inner loops.
+		For each corner, gradients are first found for every position by calling `noise`, then weighted and accumulated in a second loop,
+		which is free of calls to `noise` and is marked with `omp simd` so that it may be vectorized when compiled with `-fopenmp`.
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const {
+			using ivector = decltype(ops.floor(positions[0]));
+			using gradient = decltype(glm::normalize(noise(ops.add(ops.floor(positions[0]),indexing.grid_id(0)))));
+			each_noise_block(positions.size(), [&](const std::size_t begin, const std::size_t end){
+				ivector I[noise_block_size];
+				vector F[noise_block_size];
+				gradient G[noise_block_size];
+				scalar f[noise_block_size];
+				scalar weight_total[noise_block_size];
+				const std::size_t n(end-begin);
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					I[k] = ops.floor(positions[begin+k]);
+					F[k] = ops.fract(positions[begin+k]);
+					f[k] = scalar(0);
+					weight_total[k] = scalar(0);
+				}
+				for (int i = 0; i < indexing.size; ++i)
+				{
+					auto O = indexing.grid_id(i);
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						G[k] = glm::normalize(noise(ops.add(I[k],O)));
+					}
+					#ifdef _OPENMP
+					#pragma omp simd
+					#endif
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						const scalar weight = ops.weight(positions[begin+k],I[k],O);
+						weight_total[k] += weight;
+						f[k] += glm::dot(G[k], F[k]-vector(O)) * weight;
+					}
+				}
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					out[begin+k] = f[k] / weight_total[k];
+				}
+			});
+		}
 	};
 
 	template<int L, typename scalar, typename MosaicVectorNoise, typename MosaicOps, glm::qualifier precision=glm::defaultp>
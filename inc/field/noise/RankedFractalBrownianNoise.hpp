@@ -19,6 +19,7 @@
 #include <field/Compose.hpp>                        // Compose
 #include <field/noise/MosaicOps.hpp>                // field::VectorMosaicOps
 #include <field/noise/FractalBrownianNoise.hpp>     // dymaxion::FractalBrownianNoise
+#include <field/noise/FractalBrownianRasterization.hpp> // field::FractalBrownianRasterization
 
 namespace field
 {
@@ -67,5 +68,26 @@ namespace field
 	    return field::compose(fbm_cdf, fbm);
 	}
 
+	/*
+	`ranked_fractal_brownian_rasterization` returns a `FractalBrownianRasterization` for the output of `ranked_fractal_brownian_noise()`,
+	where the CDF of the FBN is memoized as a `TabulatedFunction` of `sample_count` samples spanning ±8 standard deviations.
+	See `FractalBrownianRasterization` for the meaning of `samples_per_wavelength`.
+	*/
+	template<typename scalar, typename Fbm>
+	inline auto ranked_fractal_brownian_rasterization(
+		const Compose<analytic::Error<scalar>,Fbm>& rfbn,
+		const scalar samples_per_wavelength = scalar(16),
+		const std::size_t sample_count = 4096
+	) {
+		const analytic::Error<scalar>& cdf(rfbn.f);
+		return fractal_brownian_rasterization(
+			rfbn.g,
+			TabulatedFunction<scalar>(cdf, 
+				cdf.mean - scalar(8)*cdf.standard_deviation, 
+				cdf.mean + scalar(8)*cdf.standard_deviation, 
+				sample_count),
+			samples_per_wavelength);
+	}
+
 }
 
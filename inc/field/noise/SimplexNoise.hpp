@@ -1,16 +1,21 @@
 #pragma once
 
 // C libraries
-#include <cmath> // sqrt
+#include <cmath>   // sqrt
+#include <cstddef> // std::size_t
 
 // std libraries
-#include <algorithm> // max
+#include <algorithm>   // max
+#include <type_traits> // std::decay_t
 
 // 3rd-party libraries
 #include <glm/common.hpp>
 #include <glm/geometric.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
 
+// in-house libraries
+#include "NoiseBlocks.hpp"
+
 namespace field
 {
 
@@ -71,52 +76,136 @@ namespace field
 
 		}
 
+		/*
+		`skew` returns the matrix that maps positions onto the lattice of simplices.
+		The batched `operator()` inverts it once per call, rather than once per position.
+		*/
 		template<typename T, glm::qualifier Q>
-		[[nodiscard]] value_type operator()(const glm::vec<4,T,Q> V) const {
+		static glm::mat<4,4,T,Q> skew(const glm::vec<4,T,Q>) {
 			using mat4 = glm::mat<4,4,T,Q>;
-			using vec4 = glm::vec<4,T,Q>;
 			using scalar = T;
 
 		    const scalar s = (std::sqrt(5.0)-1.0)/4.0;
-		    const mat4 S = mat4(1.0+s, s, s, s,
-		                        s, 1.0+s, s, s,
-		                        s, s, 1.0+s, s,
-		                        s, s, s, 1.0+s);
-		    const mat4 Sinv = glm::inverse(S);
-		    vec4 F  = glm::fract(S*V);
+		    return mat4(1.0+s, s, s, s,
+		                s, 1.0+s, s, s,
+		                s, s, 1.0+s, s,
+		                s, s, s, 1.0+s);
+		}
+
+		/*
+		`corners` stores the lattice id `I`, position offset `F`, and falloff `t` for each corner of the simplex that contains `V`,
+		where values for the `c`th corner are stored at index `c*stride`.
+		It does not call `noise`, so the batched `operator()` applies it to a block of positions in a single loop.
+		*/
+		template<typename T, glm::qualifier Q>
+		void corners(
+			const glm::vec<4,T,Q> V, 
+			const glm::mat<4,4,T,Q>& S, 
+			const glm::mat<4,4,T,Q>& Sinv, 
+			glm::vec<4,T,Q>* I, 
+			glm::vec<4,T,Q>* F, 
+			T* t, 
+			const std::size_t stride
+		) const {
+			using vec4 = glm::vec<4,T,Q>;
+			using scalar = T;
+
+		    vec4 P  = glm::fract(S*V);
 		    // simplex vertex index offsets
-		    vec4 O1; vec4 O2; vec4 O3; get_4d_simplex_index_offsets(F, O1, O2, O3);
+		    vec4 O1; vec4 O2; vec4 O3; get_4d_simplex_index_offsets(P, O1, O2, O3);
 		    // simplex vertex indices
-		    vec4 I0 = glm::floor(S*V); 
-		    vec4 I1 = I0 + O1;
-		    vec4 I2 = I0 + O2;
-		    vec4 I3 = I0 + O3;
-		    vec4 I4 = I0 + vec4(1,1,1,1);
-		    // simplex vertex positions
-		    vec4 V0 = Sinv*I0;
-		    vec4 V1 = Sinv*I1;
-		    vec4 V2 = Sinv*I2;
-		    vec4 V3 = Sinv*I3;
-		    vec4 V4 = Sinv*I4;
+		    const vec4 I0 = glm::floor(S*V); 
+		    I[0*stride] = I0;
+		    I[1*stride] = I0 + O1;
+		    I[2*stride] = I0 + O2;
+		    I[3*stride] = I0 + O3;
+		    I[4*stride] = I0 + vec4(1,1,1,1);
 		    // simplex vertex position offsets
-		    vec4 F0 = V-V0;
-		    vec4 F1 = V-V1;
-		    vec4 F2 = V-V2;
-		    vec4 F3 = V-V3;
-		    vec4 F4 = V-V4;
-		    scalar t0 = std::max( 0.5 - glm::dot(F0, F0), 0.0); t0*=t0; t0*=t0; 
-		    scalar t1 = std::max( 0.5 - glm::dot(F1, F1), 0.0); t1*=t1; t1*=t1; 
-		    scalar t2 = std::max( 0.5 - glm::dot(F2, F2), 0.0); t2*=t2; t2*=t2; 
-		    scalar t3 = std::max( 0.5 - glm::dot(F3, F3), 0.0); t3*=t3; t3*=t3; 
-		    scalar t4 = std::max( 0.5 - glm::dot(F4, F4), 0.0); t4*=t4; t4*=t4; 
-		    return 27.0 * (
-		        t0 * glm::dot(glm::normalize(noise(I0)), F0) +
-		        t1 * glm::dot(glm::normalize(noise(I1)), F1) +
-		        t2 * glm::dot(glm::normalize(noise(I2)), F2) +
-		        t3 * glm::dot(glm::normalize(noise(I3)), F3) +
-		        t4 * glm::dot(glm::normalize(noise(I4)), F4)
-		    );
+		    for (std::size_t c = 0; c < 5; ++c)
+		    {
+		        const vec4 Fc = V-Sinv*I[c*stride];
+		        scalar tc = std::max( 0.5 - glm::dot(Fc, Fc), 0.0); tc*=tc; tc*=tc; 
+		        F[c*stride] = Fc;
+		        t[c*stride] = tc;
+		    }
+		}
+
+		/*
+		`sum` returns the sum of each falloff `t` times the dot product of the gradient `G` with the offset `F`, 
+		where values for the `c`th corner are stored at index `c*stride`, and corners are summed in order.
+		*/
+		template<typename T, glm::qualifier Q>
+		static T sum(
+			const vector_type* G, 
+			const glm::vec<4,T,Q>* F, 
+			const T* t, 
+			const std::size_t stride
+		) {
+			T result = t[0] * glm::dot(G[0], F[0]);
+			for (std::size_t c = 1; c < 5; ++c)
+			{
+				result += t[c*stride] * glm::dot(G[c*stride], F[c*stride]);
+			}
+			return 27.0 * result;
+		}
 
+		template<typename T, glm::qualifier Q>
+		[[nodiscard]] value_type operator()(const glm::vec<4,T,Q> V) const {
+			using vec4 = glm::vec<4,T,Q>;
+
+			const glm::mat<4,4,T,Q> S = skew(V);
+			vec4 I[5]; vec4 F[5]; T t[5];
+			corners(V, S, glm::inverse(S), I, F, t, 1);
+			vector_type G[5];
+			for (std::size_t c = 0; c < 5; ++c)
+			{
+				G[c] = glm::normalize(noise(I[c]));
+			}
+			return sum(G, F, t, 1);
+		}
+
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position, with identical results.
+		Within each block of positions, see `noise_block_size`, the calculation proceeds in three passes over arrays that are stored corner by corner:
+		`corners` is applied to every position, then gradients are found for every corner by calling `noise`, then every `sum` is found.
+		Only the second pass calls `noise`, so the first and third are free of calls that cannot be inlined,
+		and are marked with `omp simd` so that they may be vectorized when compiled with `-fopenmp`.
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const {
+			using vector = std::decay_t<decltype(positions[0])>;
+			using scalar = typename vector::value_type;
+			const auto S = skew(vector());
+			const auto Sinv = glm::inverse(S);
+			each_noise_block(positions.size(), [&](const std::size_t begin, const std::size_t end){
+				constexpr std::size_t N(noise_block_size);
+				vector I[5*N];
+				vector F[5*N];
+				scalar t[5*N];
+				vector_type G[5*N];
+				const std::size_t n(end-begin);
+				#ifdef _OPENMP
+				#pragma omp simd
+				#endif
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					corners(positions[begin+k], S, Sinv, I+k, F+k, t+k, N);
+				}
+				for (std::size_t c = 0; c < 5; ++c)
+				{
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						G[c*N+k] = glm::normalize(noise(I[c*N+k]));
+					}
+				}
+				#ifdef _OPENMP
+				#pragma omp simd
+				#endif
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					out[begin+k] = sum(G+k, F+k, t+k, N);
+				}
+			});
 		}
 	};
 
@@ -184,46 +273,134 @@ namespace field
 
 		}
 
+		/*
+		`skew` returns the matrix that maps positions onto the lattice of simplices.
+		The batched `operator()` inverts it once per call, rather than once per position.
+		*/
 		template<typename T, glm::qualifier Q>
-		[[nodiscard]] value_type operator()(const glm::vec<3,T,Q> V) const {
+		static glm::mat<3,3,T,Q> skew(const glm::vec<3,T,Q>) {
 			using mat3 = glm::mat<3,3,T,Q>;
-			using vec3 = glm::vec<3,T,Q>;
 			using scalar = T;
 
 		    const scalar s = 1.0/3.0;
-		    const mat3 S = mat3(1.0+s, s, s,
-		                        s, 1.0+s, s,
-		                        s, s, 1.0+s);
-		    const mat3 Sinv = glm::inverse(S);
-		    vec3 F  = glm::fract(S*V);
+		    return mat3(1.0+s, s, s,
+		                s, 1.0+s, s,
+		                s, s, 1.0+s);
+		}
+
+		/*
+		`corners` stores the lattice id `I`, position offset `F`, and falloff `t` for each corner of the simplex that contains `V`,
+		where values for the `c`th corner are stored at index `c*stride`.
+		It does not call `noise`, so the batched `operator()` applies it to a block of positions in a single loop.
+		*/
+		template<typename T, glm::qualifier Q>
+		void corners(
+			const glm::vec<3,T,Q> V, 
+			const glm::mat<3,3,T,Q>& S, 
+			const glm::mat<3,3,T,Q>& Sinv, 
+			glm::vec<3,T,Q>* I, 
+			glm::vec<3,T,Q>* F, 
+			T* t, 
+			const std::size_t stride
+		) const {
+			using vec3 = glm::vec<3,T,Q>;
+			using scalar = T;
+
+		    vec3 P  = glm::fract(S*V);
 		    // simplex vertex index offsets
-		    vec3 O1; vec3 O2; get_3d_simplex_index_offsets(F, O1, O2);
+		    vec3 O1; vec3 O2; get_3d_simplex_index_offsets(P, O1, O2);
 		    // simplex vertex indices
-		    vec3 I0 = glm::floor(S*V); 
-		    vec3 I1 = I0 + O1;
-		    vec3 I2 = I0 + O2;
-		    vec3 I3 = I0 + vec3(1,1,1);
-		    // simplex vertex positions
-		    vec3 V0 = Sinv*I0;
-		    vec3 V1 = Sinv*I1;
-		    vec3 V2 = Sinv*I2;
-		    vec3 V3 = Sinv*I3;
+		    const vec3 I0 = glm::floor(S*V); 
+		    I[0*stride] = I0;
+		    I[1*stride] = I0 + O1;
+		    I[2*stride] = I0 + O2;
+		    I[3*stride] = I0 + vec3(1,1,1);
 		    // simplex vertex position offsets
-		    vec3 F0 = V-V0;
-		    vec3 F1 = V-V1;
-		    vec3 F2 = V-V2;
-		    vec3 F3 = V-V3;
-		    scalar t0 = std::max( 0.5 - glm::dot(F0, F0), 0.0); t0*=t0; t0*=t0; 
-		    scalar t1 = std::max( 0.5 - glm::dot(F1, F1), 0.0); t1*=t1; t1*=t1; 
-		    scalar t2 = std::max( 0.5 - glm::dot(F2, F2), 0.0); t2*=t2; t2*=t2; 
-		    scalar t3 = std::max( 0.5 - glm::dot(F3, F3), 0.0); t3*=t3; t3*=t3; 
-		    return 32.0 * (
-		        t0 * glm::dot(glm::normalize(noise(I0)), F0) +
-		        t1 * glm::dot(glm::normalize(noise(I1)), F1) +
-		        t2 * glm::dot(glm::normalize(noise(I2)), F2) +
-		        t3 * glm::dot(glm::normalize(noise(I3)), F3)
-		    );
+		    for (std::size_t c = 0; c < 4; ++c)
+		    {
+		        const vec3 Fc = V-Sinv*I[c*stride];
+		        scalar tc = std::max( 0.5 - glm::dot(Fc, Fc), 0.0); tc*=tc; tc*=tc; 
+		        F[c*stride] = Fc;
+		        t[c*stride] = tc;
+		    }
+		}
+
+		/*
+		`sum` returns the sum of each falloff `t` times the dot product of the gradient `G` with the offset `F`, 
+		where values for the `c`th corner are stored at index `c*stride`, and corners are summed in order.
+		*/
+		template<typename T, glm::qualifier Q>
+		static T sum(
+			const vector_type* G, 
+			const glm::vec<3,T,Q>* F, 
+			const T* t, 
+			const std::size_t stride
+		) {
+			T result = t[0] * glm::dot(G[0], F[0]);
+			for (std::size_t c = 1; c < 4; ++c)
+			{
+				result += t[c*stride] * glm::dot(G[c*stride], F[c*stride]);
+			}
+			return 32.0 * result;
+		}
+
+		template<typename T, glm::qualifier Q>
+		[[nodiscard]] value_type operator()(const glm::vec<3,T,Q> V) const {
+			using vec3 = glm::vec<3,T,Q>;
+
+			const glm::mat<3,3,T,Q> S = skew(V);
+			vec3 I[4]; vec3 F[4]; T t[4];
+			corners(V, S, glm::inverse(S), I, F, t, 1);
+			vector_type G[4];
+			for (std::size_t c = 0; c < 4; ++c)
+			{
+				G[c] = glm::normalize(noise(I[c]));
+			}
+			return sum(G, F, t, 1);
+		}
 
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position, with identical results.
+		Within each block of positions, see `noise_block_size`, the calculation proceeds in three passes over arrays that are stored corner by corner:
+		`corners` is applied to every position, then gradients are found for every corner by calling `noise`, then every `sum` is found.
+		Only the second pass calls `noise`, so the first and third are free of calls that cannot be inlined,
+		and are marked with `omp simd` so that they may be vectorized when compiled with `-fopenmp`.
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const {
+			using vector = std::decay_t<decltype(positions[0])>;
+			using scalar = typename vector::value_type;
+			const auto S = skew(vector());
+			const auto Sinv = glm::inverse(S);
+			each_noise_block(positions.size(), [&](const std::size_t begin, const std::size_t end){
+				constexpr std::size_t N(noise_block_size);
+				vector I[4*N];
+				vector F[4*N];
+				scalar t[4*N];
+				vector_type G[4*N];
+				const std::size_t n(end-begin);
+				#ifdef _OPENMP
+				#pragma omp simd
+				#endif
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					corners(positions[begin+k], S, Sinv, I+k, F+k, t+k, N);
+				}
+				for (std::size_t c = 0; c < 4; ++c)
+				{
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						G[c*N+k] = glm::normalize(noise(I[c*N+k]));
+					}
+				}
+				#ifdef _OPENMP
+				#pragma omp simd
+				#endif
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					out[begin+k] = sum(G+k, F+k, t+k, N);
+				}
+			});
 		}
 	};
 
@@ -253,38 +430,130 @@ namespace field
 		using vector_type = typename MosaicVectorNoise::value_type;
 		using value_type = typename vector_type::value_type;
 
+		/*
+		`skew` returns the matrix that maps positions onto the lattice of simplices.
+		The batched `operator()` inverts it once per call, rather than once per position.
+		*/
 		template<typename T, glm::qualifier Q>
-		value_type operator()(const glm::vec<2,T,Q> V) const {
+		static glm::mat<2,2,T,Q> skew(const glm::vec<2,T,Q>) {
 			using mat2 = glm::mat<2,2,T,Q>;
-			using vec2 = glm::vec<2,T,Q>;
 			using scalar = T;
 
 		    const scalar s = (std::sqrt(3.0)-1.0)/2.0;
-		    const mat2 S = mat2(1.0+s, s,
-		                        s, 1.0+s);
-		    const mat2 Sinv = glm::inverse(S);
-		    vec2 F  = glm::fract(S*V);
+		    return mat2(1.0+s, s,
+		                s, 1.0+s);
+		}
+
+		/*
+		`corners` stores the lattice id `I`, position offset `F`, and falloff `t` for each corner of the simplex that contains `V`,
+		where values for the `c`th corner are stored at index `c*stride`.
+		It does not call `noise`, so the batched `operator()` applies it to a block of positions in a single loop.
+		*/
+		template<typename T, glm::qualifier Q>
+		void corners(
+			const glm::vec<2,T,Q> V, 
+			const glm::mat<2,2,T,Q>& S, 
+			const glm::mat<2,2,T,Q>& Sinv, 
+			glm::vec<2,T,Q>* I, 
+			glm::vec<2,T,Q>* F, 
+			T* t, 
+			const std::size_t stride
+		) const {
+			using vec2 = glm::vec<2,T,Q>;
+			using scalar = T;
+
+		    vec2 P  = glm::fract(S*V);
 		    // simplex vertex indices
-		    vec2 I0 = glm::floor(S*V); 
-		    vec2 I1 = I0 + (F.x > F.y? vec2(1,0) : vec2(0,1));
-		    vec2 I2 = I0 + vec2(1,1);
-		    // simplex vertex positions
-		    vec2 V0 = Sinv*I0;
-		    vec2 V1 = Sinv*I1;
-		    vec2 V2 = Sinv*I2;
+		    const vec2 I0 = glm::floor(S*V); 
+		    I[0*stride] = I0;
+		    I[1*stride] = I0 + (P.x > P.y? vec2(1,0) : vec2(0,1));
+		    I[2*stride] = I0 + vec2(1,1);
 		    // simplex vertex position offsets
-		    vec2 F0 = V-V0;
-		    vec2 F1 = V-V1;
-		    vec2 F2 = V-V2;
-		    scalar t0 = std::max( 0.5 - glm::dot(F0, F0), 0.0); t0*=t0; t0*=t0; 
-		    scalar t1 = std::max( 0.5 - glm::dot(F1, F1), 0.0); t1*=t1; t1*=t1; 
-		    scalar t2 = std::max( 0.5 - glm::dot(F2, F2), 0.0); t2*=t2; t2*=t2; 
-		    return 30.0 * (
-		        t0 * glm::dot(glm::normalize(noise(I0)), F0) +
-		        t1 * glm::dot(glm::normalize(noise(I1)), F1) +
-		        t2 * glm::dot(glm::normalize(noise(I2)), F2)
-		    );
+		    for (std::size_t c = 0; c < 3; ++c)
+		    {
+		        const vec2 Fc = V-Sinv*I[c*stride];
+		        scalar tc = std::max( 0.5 - glm::dot(Fc, Fc), 0.0); tc*=tc; tc*=tc; 
+		        F[c*stride] = Fc;
+		        t[c*stride] = tc;
+		    }
+		}
+
+		/*
+		`sum` returns the sum of each falloff `t` times the dot product of the gradient `G` with the offset `F`, 
+		where values for the `c`th corner are stored at index `c*stride`, and corners are summed in order.
+		*/
+		template<typename T, glm::qualifier Q>
+		static T sum(
+			const vector_type* G, 
+			const glm::vec<2,T,Q>* F, 
+			const T* t, 
+			const std::size_t stride
+		) {
+			T result = t[0] * glm::dot(G[0], F[0]);
+			for (std::size_t c = 1; c < 3; ++c)
+			{
+				result += t[c*stride] * glm::dot(G[c*stride], F[c*stride]);
+			}
+			return 30.0 * result;
+		}
+
+		template<typename T, glm::qualifier Q>
+		[[nodiscard]] value_type operator()(const glm::vec<2,T,Q> V) const {
+			using vec2 = glm::vec<2,T,Q>;
+
+			const glm::mat<2,2,T,Q> S = skew(V);
+			vec2 I[3]; vec2 F[3]; T t[3];
+			corners(V, S, glm::inverse(S), I, F, t, 1);
+			vector_type G[3];
+			for (std::size_t c = 0; c < 3; ++c)
+			{
+				G[c] = glm::normalize(noise(I[c]));
+			}
+			return sum(G, F, t, 1);
+		}
 
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position, with identical results.
+		Within each block of positions, see `noise_block_size`, the calculation proceeds in three passes over arrays that are stored corner by corner:
+		`corners` is applied to every position, then gradients are found for every corner by calling `noise`, then every `sum` is found.
+		Only the second pass calls `noise`, so the first and third are free of calls that cannot be inlined,
+		and are marked with `omp simd` so that they may be vectorized when compiled with `-fopenmp`.
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const {
+			using vector = std::decay_t<decltype(positions[0])>;
+			using scalar = typename vector::value_type;
+			const auto S = skew(vector());
+			const auto Sinv = glm::inverse(S);
+			each_noise_block(positions.size(), [&](const std::size_t begin, const std::size_t end){
+				constexpr std::size_t N(noise_block_size);
+				vector I[3*N];
+				vector F[3*N];
+				scalar t[3*N];
+				vector_type G[3*N];
+				const std::size_t n(end-begin);
+				#ifdef _OPENMP
+				#pragma omp simd
+				#endif
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					corners(positions[begin+k], S, Sinv, I+k, F+k, t+k, N);
+				}
+				for (std::size_t c = 0; c < 3; ++c)
+				{
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						G[c*N+k] = glm::normalize(noise(I[c*N+k]));
+					}
+				}
+				#ifdef _OPENMP
+				#pragma omp simd
+				#endif
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					out[begin+k] = sum(G+k, F+k, t+k, N);
+				}
+			});
 		}
 	};
 
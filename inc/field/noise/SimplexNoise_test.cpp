@@ -2,6 +2,7 @@
 // std libraries
 #include <limits>
 #include <string>
+#include <vector>
 
 // 3rd party libraries
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
@@ -26,6 +27,7 @@
 
 #include <test/properties.hpp>  
 #include <test/macros.hpp>  
+#include <test/mismatch.hpp>
 #include <test/glm/adapter.hpp>
 
 TEST_CASE( "SimplexNoise()", "[field]" ) {
@@ -67,5 +69,11 @@ TEST_CASE( "SimplexNoise()", "[field]" ) {
     auto out = procedural::map(noise, positions);
     CHECK(std::abs(whole::mean(out)) < 0.05);
     CHECK(whole::standard_deviation(out) > 0.1);
+
+    SECTION("SimplexNoise(positions, out) must produce results that are identical to SimplexNoise(…)"){
+        std::vector<double> batched(positions.size());
+        noise(positions, batched);
+        CHECK(test::mismatch_count(batched, procedural::map(noise, positions)) == 0);
+    }
 }
 
@@ -0,0 +1,341 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::acos, std::cos, std::sin
+#include <cstddef>   // std::size_t
+
+// std libraries
+#include <algorithm>   // std::clamp, std::max, std::min, std::sort
+#include <type_traits> // std::decay_t
+#include <utility>     // std::declval
+#include <vector>      // std::vector
+
+// 3rd-party libraries
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "NoiseBlocks.hpp"
+
+namespace field
+{
+
+	/*
+	`SphericalCapNoise` is a variant of the terrain generation algorithm of Hugo Elias (see `EliasNoise`) 
+	where each region is a spherical cap with a smooth boundary, so that for a normalized position n:
+
+		out = Σᵢ smoothstep(thresholdᵢ - width/2, thresholdᵢ + width/2, n⋅centerᵢ)
+
+	Unlike `EliasNoise`, whose thresholds are disabled, a cap contributes exactly 0 to positions outside it,
+	so each position only needs to visit caps that can reach it.
+	Caps are binned by the vertices of a coarse `Grid`, such as a `dymaxion::Grid`, where a cap is added to the bin of each vertex
+	whose cell it might overlap, and a position visits only the bin of `grid.nearest_vertex_id(n)`.
+	Caps within a bin are visited in order of region, so output is identical to that of visiting every cap.
+	The cell of a vertex is assumed to lie within the distance of its farthest neighbor,
+	which is roughly twice the extent of the cell and so leaves a margin for rounding.
+	Bins are found by walking `grid` outward from the center of each cap, see `each_vertex_near`,
+	so the cost of construction grows with the number of bins that caps reach, rather than with the number of bins times caps.
+
+	`splat()` instead rasterizes each cap onto the vertices of a grid directly, by walking that grid in the same way.
+	It likewise produces output that is identical to that of visiting every cap,
+	but since vertices are visited out of order, it is only faster than binning when caps cover a small fraction of the sphere.
+
+	`Grid` is used through the following properties:
+		vertex_count()
+		vertex_position()
+		nearest_vertex_id()
+		arrows_per_vertex
+		arrow_target_id()
+	*/
+	template<typename T, typename RegionThreshold, typename RegionCenter, typename Grid>
+	struct SphericalCapNoise
+	{
+		static constexpr T pi = T(3.141592653589793238462643383279502884L);
+		using vector = std::decay_t<decltype(std::declval<const RegionCenter&>()[0])>;
+
+		RegionCenter region_center;
+		RegionThreshold region_threshold;
+		T region_transition_width;
+		unsigned int region_count;
+		Grid grid;
+		// regions of the bin for vertex `i` of `grid` are stored within `bin_regions` from `bin_offsets[i]` to `bin_offsets[i+1]`
+		std::vector<std::size_t> bin_offsets;
+		std::vector<unsigned int> bin_regions;
+		// centers and smoothstep edges of each region, cached since `RegionCenter` and `RegionThreshold` are typically procedural
+		std::vector<vector> centers;
+		std::vector<T> edge0s;
+		std::vector<T> edge1s;
+
+		explicit SphericalCapNoise(
+			const Grid& grid,
+			const RegionCenter& region_center,
+			const RegionThreshold& region_threshold,
+			const unsigned int region_count,
+			const T region_transition_width=T(0.03)
+		):
+			region_center(region_center),
+			region_threshold(region_threshold),
+			region_transition_width(region_transition_width),
+			region_count(region_count),
+			grid(grid),
+			bin_offsets(grid.vertex_count()+1, 0),
+			centers(region_count),
+			edge0s(region_count),
+			edge1s(region_count)
+		{
+			for (unsigned int j = 0; j < region_count; ++j)
+			{
+				const T threshold(region_threshold[j]);
+				centers[j] = region_center[j];
+				edge0s[j] = threshold - region_transition_width/T(2);
+				edge1s[j] = threshold + region_transition_width/T(2);
+			}
+
+			// the cosine and sine of the radius of each cell, so that cap j reaches the cell of vertex i 
+			// if the dot product of their centers is at least cos(reach+radius) = cos(reach)cos(radius) - sin(reach)sin(radius)
+			const std::size_t vertex_count(grid.vertex_count());
+			std::vector<decltype(glm::normalize(grid.vertex_position(0)))> normalized(vertex_count);
+			std::vector<T> cell_radii(vertex_count);
+			std::vector<T> cell_cosines(vertex_count);
+			std::vector<T> cell_sines(vertex_count);
+			T max_cell_radius(0);
+			for (std::size_t i = 0; i < vertex_count; ++i)
+			{
+				normalized[i] = glm::normalize(grid.vertex_position(i));
+				cell_radii[i] = neighbor_angle(grid, i);
+				cell_cosines[i] = std::cos(cell_radii[i]);
+				cell_sines[i] = std::sin(cell_radii[i]);
+				max_cell_radius = std::max(max_cell_radius, cell_radii[i]);
+			}
+
+			// find the bins of each cap in order of region, then sort them stably by bin, so that each bin lists caps in order of region
+			std::vector<std::size_t> pair_bins;
+			std::vector<unsigned int> pair_regions;
+			std::vector<unsigned int> visited(vertex_count, 0);
+			std::vector<std::size_t> frontier;
+			for (unsigned int j = 0; j < region_count; ++j)
+			{
+				const T reach(cap_angle(j));
+				const T reach_cosine(std::cos(reach));
+				const T reach_sine(std::sin(reach));
+				const auto unit_center(glm::normalize(centers[j]));
+				const T min_cosine(reach + max_cell_radius >= pi? T(-1) : std::cos(reach + max_cell_radius));
+				each_vertex_near(grid, normalized, unit_center, min_cosine, j+1, visited, frontier, [&](const std::size_t i){
+					if (reach + cell_radii[i] >= pi || 
+						glm::dot(normalized[i], unit_center) >= reach_cosine*cell_cosines[i] - reach_sine*cell_sines[i])
+					{
+						pair_bins.push_back(i);
+						pair_regions.push_back(j);
+					}
+				});
+			}
+			for (std::size_t k = 0; k < pair_bins.size(); ++k)
+			{
+				++bin_offsets[pair_bins[k]+1];
+			}
+			for (std::size_t i = 0; i < vertex_count; ++i)
+			{
+				bin_offsets[i+1] += bin_offsets[i];
+			}
+			bin_regions.resize(pair_bins.size());
+			std::vector<std::size_t> bin_sizes(vertex_count, 0);
+			for (std::size_t k = 0; k < pair_bins.size(); ++k)
+			{
+				const std::size_t i(pair_bins[k]);
+				bin_regions[bin_offsets[i] + bin_sizes[i]++] = pair_regions[k];
+			}
+		}
+
+		using value_type = T;
+
+		template<int L, glm::qualifier Q>
+		[[nodiscard]] T operator()(const glm::vec<L,T,Q>& position) const {
+			const glm::vec<L,T,Q> normalized(glm::normalize(position));
+			const std::size_t bin(grid.nearest_vertex_id(normalized));
+			T out(0);
+			for (std::size_t k = bin_offsets[bin]; k < bin_offsets[bin+1]; ++k)
+			{
+				out += region_value(bin_regions[k], normalized);
+			}
+			return out;
+		}
+
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position, with identical results.
+		Within each block of positions, see `noise_block_size`, positions are sorted by bin, 
+		and each cap of a bin is applied to every position of the block within that bin before the next cap,
+		in a loop that is marked with `omp simd` so that it may be vectorized when compiled with `-fopenmp`.
+		Neighboring positions of a raster typically share a bin, so each cap is loaded once for many positions.
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const {
+			using normal = std::decay_t<decltype(glm::normalize(positions[0]))>;
+			each_noise_block(positions.size(), [&](const std::size_t begin, const std::size_t end){
+				normal normalized[noise_block_size];
+				std::size_t bins[noise_block_size];
+				std::size_t order[noise_block_size];
+				T sums[noise_block_size];
+				const std::size_t n(end-begin);
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					normalized[k] = glm::normalize(positions[begin+k]);
+					bins[k] = grid.nearest_vertex_id(normalized[k]);
+					order[k] = k;
+					sums[k] = T(0);
+				}
+				std::sort(order, order+n, [&](const std::size_t a, const std::size_t b){ return bins[a] < bins[b]; });
+				for (std::size_t first = 0; first < n;)
+				{
+					const std::size_t bin(bins[order[first]]);
+					std::size_t last(first+1);
+					while (last < n && bins[order[last]] == bin)
+					{
+						++last;
+					}
+					for (std::size_t r = bin_offsets[bin]; r < bin_offsets[bin+1]; ++r)
+					{
+						const unsigned int region(bin_regions[r]);
+						#ifdef _OPENMP
+						#pragma omp simd
+						#endif
+						for (std::size_t k = first; k < last; ++k)
+						{
+							sums[order[k]] += region_value(region, normalized[order[k]]);
+						}
+					}
+					first = last;
+				}
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					out[begin+k] = sums[k];
+				}
+			});
+		}
+
+		/*
+		`splat` stores in `out` the value of noise for each vertex of `raster_grid`,
+		which need not be the grid that is used to bin regions.
+		`out` is filled with 0 before regions are added.
+		*/
+		template<typename RasterGrid, typename Out>
+		void splat(const RasterGrid& raster_grid, Out& out) const {
+			using id = std::size_t;
+			const id vertex_count(raster_grid.vertex_count());
+			T vertex_spacing(0);
+			std::vector<decltype(glm::normalize(raster_grid.vertex_position(0)))> normalized(vertex_count);
+			for (id i = 0; i < vertex_count; ++i)
+			{
+				out[i] = T(0);
+				normalized[i] = glm::normalize(raster_grid.vertex_position(i));
+				vertex_spacing = std::max(vertex_spacing, neighbor_angle(raster_grid, i));
+			}
+			std::vector<unsigned int> visited(vertex_count, 0);
+			std::vector<id> frontier;
+			for (unsigned int j = 0; j < region_count; ++j)
+			{
+				const T reach(cap_angle(j));
+				if (reach >= pi)
+				{
+					for (id i = 0; i < vertex_count; ++i)
+					{
+						out[i] += region_value(j, normalized[i]);
+					}
+					continue;
+				}
+				const auto unit_center(glm::normalize(centers[j]));
+				const T min_cosine(std::cos(std::min(reach + vertex_spacing, pi)));
+				each_vertex_near(raster_grid, normalized, unit_center, min_cosine, j+1, visited, frontier, [&](const id i){
+					out[i] += region_value(j, normalized[i]);
+				});
+			}
+		}
+
+	private:
+
+		template<typename vector2>
+		inline T region_value(const unsigned int i, const vector2& normalized) const
+		{
+			return glm::smoothstep(edge0s[i], edge1s[i], glm::dot(normalized, centers[i]));
+		}
+
+		/*
+		`cap_angle` returns the angular radius of the region beyond which its contribution is exactly 0,
+		or π if the region reaches every position.
+		*/
+		inline T cap_angle(const unsigned int i) const
+		{
+			const T lo(edge0s[i]);
+			const T center_length(glm::length(centers[i]));
+			return lo / center_length <= T(-1)? pi : std::acos(std::clamp(lo / center_length, T(-1), T(1)));
+		}
+
+		/*
+		`each_vertex_near` calls `f(i)` once for each vertex `i` of `grid` that is connected to the vertex nearest `unit_center` 
+		through vertices whose normalized positions have a dot product with `unit_center` of at least `min_cosine`.
+		`visited[i]` stores the last `mark` that visited vertex `i`, so that it need not be cleared between calls with distinct marks.
+		*/
+		template<typename GridLike, typename Normals, typename vector2, typename F>
+		static void each_vertex_near(
+			const GridLike& grid, 
+			const Normals& normalized, 
+			const vector2& unit_center, 
+			const T min_cosine, 
+			const unsigned int mark, 
+			std::vector<unsigned int>& visited, 
+			std::vector<std::size_t>& frontier, 
+			const F& f
+		) {
+			const std::size_t N(grid.arrows_per_vertex);
+			const std::size_t start(grid.nearest_vertex_id(unit_center));
+			frontier.clear();
+			frontier.push_back(start);
+			visited[start] = mark;
+			while (!frontier.empty())
+			{
+				const std::size_t i(frontier.back());
+				frontier.pop_back();
+				f(i);
+				for (std::size_t k = 0; k < N; ++k)
+				{
+					const std::size_t neighbor(grid.arrow_target_id(i,k));
+					if (visited[neighbor] != mark && glm::dot(normalized[neighbor], unit_center) >= min_cosine)
+					{
+						visited[neighbor] = mark;
+						frontier.push_back(neighbor);
+					}
+				}
+			}
+		}
+
+		template<typename vector2>
+		static inline T angle(const vector2& a, const vector2& b)
+		{
+			return std::acos(std::clamp(T(glm::dot(a, b)), T(-1), T(1)));
+		}
+
+		template<typename GridLike>
+		static T neighbor_angle(const GridLike& grid, const std::size_t i)
+		{
+			const auto vertex(glm::normalize(grid.vertex_position(i)));
+			T result(0);
+			for (std::size_t j = 0; j < std::size_t(grid.arrows_per_vertex); ++j)
+			{
+				result = std::max(result, angle(vertex, glm::normalize(grid.vertex_position(grid.arrow_target_id(i,j)))));
+			}
+			return result;
+		}
+
+	};
+
+	template<typename T, typename RegionThreshold, typename RegionCenter, typename Grid>
+	inline auto spherical_cap_noise(
+		const Grid& grid,
+		const RegionCenter& region_center,
+		const RegionThreshold& region_threshold,
+		const unsigned int region_count,
+		const T region_transition_width=T(0.03))
+	{
+		return SphericalCapNoise<T,RegionThreshold,RegionCenter,Grid>(grid, region_center, region_threshold, region_count, region_transition_width);
+	}
+
+}
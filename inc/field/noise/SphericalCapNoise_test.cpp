@@ -0,0 +1,66 @@
+
+// std libraries
+#include <vector>
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>     // *vec3
+
+// in-house libraries
+#include <index/procedural/Map.hpp>
+#include <index/procedural/noise/GaussianNoise.hpp>
+#include <index/procedural/noise/glm/UnitVectorNoise.hpp>
+
+#include <grid/dymaxion/Grid.hpp>
+
+#include "SphericalCapNoise.hpp"
+
+#include <test/mismatch.hpp>
+
+TEST_CASE( "SphericalCapNoise()", "[field]" ) {
+    auto region_center = procedural::unit_vector_noise<3>(10.0, 1e4);
+    auto region_threshold = procedural::gaussian(11.0, 1.1e4);
+    const unsigned int region_count(300);
+    const double region_transition_width(0.03);
+    dymaxion::Grid<int,int,double> bins(1.0, 4);
+    dymaxion::Grid<int,int,double> raster(2.0, 16);
+    auto noise = field::spherical_cap_noise<double>(bins, region_center, region_threshold, region_count, region_transition_width);
+
+    std::vector<glm::dvec3> positions(raster.vertex_count());
+    std::vector<double> expected(raster.vertex_count());
+    for (int i = 0; i < raster.vertex_count(); ++i)
+    {
+        positions[i] = raster.vertex_position(i);
+        const glm::dvec3 normalized(glm::normalize(positions[i]));
+        expected[i] = 0.0;
+        for (unsigned int j = 0; j < region_count; ++j)
+        {
+            expected[i] += glm::smoothstep(
+                region_threshold[j] - region_transition_width/2.0,
+                region_threshold[j] + region_transition_width/2.0,
+                glm::dot(normalized, region_center[j]));
+        }
+    }
+
+    SECTION("SphericalCapNoise(…) must produce results that are identical to visiting every region"){
+        CHECK(test::mismatch_count(procedural::map(noise, positions), expected) == 0);
+    }
+
+    SECTION("SphericalCapNoise(positions, out) must produce results that are identical to SphericalCapNoise(…)"){
+        std::vector<double> batched(positions.size());
+        noise(positions, batched);
+        CHECK(test::mismatch_count(batched, procedural::map(noise, positions)) == 0);
+    }
+
+    SECTION("SphericalCapNoise(…) must cull regions that cannot reach a bin"){
+        CHECK(noise.bin_regions.size() < std::size_t(region_count) * bins.vertex_count());
+    }
+
+    SECTION("SphericalCapNoise::splat(…) must produce results that are identical to visiting every region"){
+        std::vector<double> out(raster.vertex_count());
+        noise.splat(raster, out);
+        CHECK(test::mismatch_count(out, expected) == 0);
+    }
+}
@@ -13,6 +13,8 @@
 #include <math/glm/special.hpp>
 #include <grid/cartesian/OrthantIndexing.hpp>
 
+#include "NoiseBlocks.hpp"
+
 namespace field
 {
 
@@ -72,6 +74,51 @@ namespace field
 		    }
 		    return f / weight_total;
 		}
+
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position, with identical results.
+		Within each block of positions, see `noise_block_size`, corners are visited in the outer loop and positions in the inner loops.
+		For each corner, values are first found for every position by calling `noise`, then weighted and accumulated in a second loop,
+		which is free of calls to `noise` and is marked with `omp simd` so that it may be vectorized when compiled with `-fopenmp`.
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const {
+			using ivector = decltype(ops.floor(positions[0]));
+			each_noise_block(positions.size(), [&](const std::size_t begin, const std::size_t end){
+				ivector I[noise_block_size];
+				scalar values[noise_block_size];
+				scalar f[noise_block_size];
+				scalar weight_total[noise_block_size];
+				const std::size_t n(end-begin);
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					I[k] = ops.floor(positions[begin+k]);
+					f[k] = scalar(0);
+					weight_total[k] = scalar(0);
+				}
+				for (int i = 0; i < indexing.size; ++i)
+				{
+					auto O = indexing.grid_id(i);
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						values[k] = noise(ops.add(I[k],O));
+					}
+					#ifdef _OPENMP
+					#pragma omp simd
+					#endif
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						const scalar weight = ops.weight(positions[begin+k],I[k],O);
+						weight_total[k] += weight;
+						f[k] += values[k] * weight;
+					}
+				}
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					out[begin+k] = f[k] / weight_total[k];
+				}
+			});
+		}
 	};
 
 	template<int L, typename scalar, typename MosaicNoise, typename MosaicOps, glm::qualifier precision=glm::defaultp>
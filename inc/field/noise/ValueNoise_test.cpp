@@ -2,6 +2,7 @@
 // std libraries
 #include <limits>
 #include <string>
+#include <vector>
 
 // 3rd party libraries
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
@@ -20,13 +21,19 @@
 #include <index/procedural/glm/VectorInterleave.hpp>
 #include <index/procedural/noise/GaussianNoise.hpp>
 #include <index/procedural/noise/glm/UnitVectorNoise.hpp>
+#include <math/analytic/Sum.hpp>
+#include <math/analytic/Gaussian.hpp>
+#include <math/analytic/Error.hpp>
+#include <field/Compose.hpp>
 
 #include "MosaicNoise.hpp"
 #include "MosaicOps.hpp"
 #include "ValueNoise.hpp"
+#include "FractalBrownianNoise.hpp"
 
 #include <test/properties.hpp>  
 #include <test/macros.hpp>  
+#include <test/mismatch.hpp>
 #include <test/glm/adapter.hpp>
 
 TEST_CASE( "ValueNoise()", "[field]" ) {
@@ -61,5 +68,47 @@ TEST_CASE( "ValueNoise()", "[field]" ) {
     auto out = procedural::map(noise, positions);
     CHECK(std::abs(whole::mean(out)) < 0.05);
     CHECK(whole::standard_deviation(out) > 0.1);
+
+    SECTION("ValueNoise(positions, out) must produce results that are identical to ValueNoise(…)"){
+        std::vector<double> batched(positions.size());
+        noise(positions, batched);
+        CHECK(test::mismatch_count(batched, procedural::map(noise, positions)) == 0);
+    }
+}
+
+
+TEST_CASE( "FractalBrownianNoise()", "[field]" ) {
+
+    auto positions = known::mult(
+        procedural::get(
+            procedural::vector_interleave<3>(
+                procedural::UnitIntervalNoise<double>()), 
+            procedural::Range(10000)),
+        procedural::uniform(100.0)
+    );
+
+    auto noise = 
+        field::fractal_brownian_noise<int,double>(
+            field::value_noise<3,double>(
+                field::mosaic_noise(procedural::gaussian(11.0, 1.1e4)),
+                field::vector_mosaic_ops<3,int,double>()
+            ), 8, 0.5, 0.01
+        );
+
+    SECTION("FractalBrownianNoise(positions, out, scratch) must produce results that are identical to FractalBrownianNoise(…)"){
+        std::vector<double> batched(positions.size());
+        field::FractalBrownianNoiseScratch<glm::dvec3,double> scratch(positions.size());
+        noise(positions, batched, scratch);
+        CHECK(test::mismatch_count(batched, procedural::map(noise, positions)) == 0);
+    }
+
+    SECTION("Compose(positions, out, intermediate, scratch) must produce results that are identical to Compose(…)"){
+        auto composed = field::compose(analytic::Error(0.0, 1.0, 1.0), noise);
+        std::vector<double> batched(positions.size());
+        std::vector<double> intermediate(positions.size());
+        field::FractalBrownianNoiseScratch<glm::dvec3,double> scratch(positions.size());
+        composed(positions, batched, intermediate, scratch);
+        CHECK(test::mismatch_count(batched, procedural::map(composed, positions)) == 0);
+    }
 }
 
@@ -11,6 +11,8 @@
 #include <glm/geometric.hpp>
 #include <grid/cartesian/BoundedIndexing.hpp>
 
+#include "NoiseBlocks.hpp"
+
 namespace field
 {
 
@@ -58,6 +60,49 @@ namespace field
 
 		    return nearest_distance;
 		}
+
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position, with identical results.
+		Within each block of positions, see `noise_block_size`, the 3ᴸ neighboring cells are visited in the outer loop and positions in the inner loops.
+		For each cell, the points of every position are first found by calling `noise`, then compared against the nearest distance in a second loop,
+		which is free of calls to `noise` and is marked with `omp simd` so that it may be vectorized when compiled with `-fopenmp`.
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const {
+			using ivector = decltype(ops.floor(positions[0]));
+			using point = decltype(ops.add(ops.floor(positions[0]), noise(ops.floor(positions[0]))));
+			each_noise_block(positions.size(), [&](const std::size_t begin, const std::size_t end){
+				ivector I[noise_block_size];
+				point neighbor_position[noise_block_size];
+				scalar nearest_distance[noise_block_size];
+				const std::size_t n(end-begin);
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					I[k] = ops.floor(positions[begin+k]);
+					nearest_distance[k] = std::numeric_limits<scalar>::max();
+				}
+				for (int i = 0; i < indexing.size; ++i)
+				{
+					auto O = indexing.grid_id(i)-1;
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						auto neighbor_id = ops.add(I[k], O);
+						neighbor_position[k] = ops.add(neighbor_id, noise(neighbor_id));
+					}
+					#ifdef _OPENMP
+					#pragma omp simd
+					#endif
+					for (std::size_t k = 0; k < n; ++k)
+					{
+						nearest_distance[k] = std::min(nearest_distance[k], ops.distance(positions[begin+k], neighbor_position[k]));
+					}
+				}
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					out[begin+k] = nearest_distance[k];
+				}
+			});
+		}
 	};
 
 	template<int L, typename scalar, typename MosaicVectorNoise, typename MosaicOps, glm::qualifier precision=glm::defaultp>
@@ -2,6 +2,7 @@
 // std libraries
 #include <limits>
 #include <string>
+#include <vector>
 
 // 3rd party libraries
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
@@ -27,6 +28,7 @@
 
 #include <test/properties.hpp>  
 #include <test/macros.hpp>  
+#include <test/mismatch.hpp>
 #include <test/glm/adapter.hpp>
 
 TEST_CASE( "WorleyNoise()", "[field]" ) {
@@ -64,5 +66,11 @@ TEST_CASE( "WorleyNoise()", "[field]" ) {
     CHECK(whole::min(out) >= 0.00);
     CHECK(whole::max(out) >  1.0);
     CHECK(whole::standard_deviation(out) > 0.1);
+
+    SECTION("WorleyNoise(positions, out) must produce results that are identical to WorleyNoise(…)"){
+        std::vector<double> batched(positions.size());
+        noise(positions, batched);
+        CHECK(test::mismatch_count(batched, procedural::map(noise, positions)) == 0);
+    }
 }
 
@@ -5,3 +5,5 @@
 #include "./WorleyNoise_test.cpp"
 #include "./MosaicNoise_test.cpp"
 #include "./CurlNoise_test.cpp"
+#include "./FractalBrownianRasterization_test.cpp"
+#include "./SphericalCapNoise_test.cpp"
@@ -28,6 +28,8 @@ namespace field
 	A `std::unordered_map` is able to represent orthtrees of arbitrary depth in a reasonable amount of memory,
 	however it is not stored in contiguous memory, and it requires running additional hashing logic,
 	so a `ShallowBarnesHutMultipole` may be faster if required accuracy is low enough to have a small memory footprint.
+	If particles can be rebuilt all at once, `LinearBarnesHutMultipole` avoids hashing altogether
+	and traverses cells using a θ-criterion, which is both faster and more accurate for large particle counts.
 	*/
 	template<int dimension_count, typename id, typename scalar, typename Monopole, glm::qualifier quality = glm::defaultp>
 	class DeepBarnesHutMultipole
@@ -1,7 +1,6 @@
 // std libraries
 #include <limits>
 #include <string>
-#include <format>
 #include <iostream>
 
 // 3rd party libraries
@@ -21,6 +20,7 @@
 #include <index/procedural/glm/VectorInterleave.hpp>
 #include <index/procedural/noise/UnitIntervalNoise.hpp>
 
+#include "MonopoleVector.hpp"
 #include "NaiveMultipole.hpp"
 #include "DeepBarnesHutMultipole.hpp"
 
@@ -32,6 +32,8 @@
 
 TEST_CASE( "DeepBarnesHutMultipole()", "[field]" ) {
     
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+
     test::GlmAdapter<int, double> fine(1e-10);
     test::GlmAdapter<int, double> coarse(1e-5); // 1 mm accuracy
 
@@ -52,8 +54,8 @@ TEST_CASE( "DeepBarnesHutMultipole()", "[field]" ) {
         procedural::uniform(10.0)
     );
 
-    field::NaiveMultipole<2, double, glm::dvec3> naive(1.0);
-    field::DeepBarnesHutMultipole<3, 2, int, double> barnes_hut(
+    field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1.0);
+    field::DeepBarnesHutMultipole<3, int, double, Monopole> barnes_hut(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
@@ -70,12 +72,12 @@ TEST_CASE( "DeepBarnesHutMultipole()", "[field]" ) {
         sample_positions
     ));
 
-    field::DeepBarnesHutMultipole<3, 2, int, double> forward(
+    field::DeepBarnesHutMultipole<3, int, double, Monopole> forward(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
     );
-    field::DeepBarnesHutMultipole<3, 2, int, double> reverse(
+    field::DeepBarnesHutMultipole<3, int, double, Monopole> reverse(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
@@ -97,12 +99,12 @@ TEST_CASE( "DeepBarnesHutMultipole()", "[field]" ) {
         sample_positions
     ));
 
-    field::DeepBarnesHutMultipole<3, 2, int, double> base(
+    field::DeepBarnesHutMultipole<3, int, double, Monopole> base(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
     );
-    field::DeepBarnesHutMultipole<3, 2, int, double> scaled(
+    field::DeepBarnesHutMultipole<3, int, double, Monopole> scaled(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
@@ -0,0 +1,331 @@
+#pragma once
+
+// C libraries
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+
+// std libraries
+#include <type_traits> // std::is_same_v
+#include <utility>     // std::declval, std::pair
+#include <vector>      // std::vector
+
+// 3rd party libraries
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "LinearOrthtree.hpp"
+
+namespace field
+{
+
+	/*
+	`FastMultipole` finds the value acting on each particle of a multipole field, as `LinearBarnesHutMultipole::self_values()` does,
+	but using the fast multipole method, which is O(N) rather than O(N log N).
+
+	Where Barnes-Hut compares each particle with cells, the fast multipole method compares cells with cells.
+	The `LinearOrthtree` is traversed from the root in pairs of cells (A,B):
+	if A and B are well separated, the multipole of B is converted to a local expansion about the center of A ("M2L"),
+	if both are leaves, particles of B are summed directly for each particle of A ("P2P"),
+	and otherwise the larger of the two is split into its children.
+	Cells are well separated if the sum of their radii is less than θ times the distance between their centers.
+	Local expansions are then shifted from each cell to its children ("L2L"),
+	and evaluated at the particles of each leaf, where they are added to the direct sums.
+	Multipoles of cells are summed from their children when the orthtree is built ("M2M").
+
+	A local expansion stores the value at the center of a cell and its first and second derivatives,
+	so `Multipole` must offer `derivative_for_offset()` and `second_derivative_for_offset()`,
+	as do `MonopoleVector`, `MonopoleScalar`, `QuadrupoleVector`, and `QuadrupoleScalar`.
+	Local expansions are quadratic, so a `Quadrupole*` is recommended to match their order of accuracy.
+
+	Pairs of cells are found serially, but M2L, P2P, and evaluation are distributed across OpenMP threads by target cell,
+	so results do not depend on thread count.
+	*/
+	template<int dimension_count, typename id, typename scalar, typename Multipole, glm::qualifier quality = glm::defaultp>
+	class FastMultipole
+	{
+
+		using vector = glm::vec<dimension_count, scalar, quality>;
+		using Tree = LinearOrthtree<dimension_count, id, scalar, Multipole, quality>;
+		using Value = decltype(Multipole::zero());
+		using Derivative = decltype(std::declval<const Multipole&>().derivative_for_offset(std::declval<vector>()));
+		using SecondDerivative = decltype(std::declval<const Multipole&>().second_derivative_for_offset(std::declval<vector>()));
+
+		scalar theta;
+		scalar self_interaction_distance2_threshold;
+		Tree tree;
+
+		// local expansions about the center of each cell, kept between calls to avoid reallocation
+		std::vector<Value> local_values;
+		std::vector<Derivative> local_derivatives;
+		std::vector<SecondDerivative> local_second_derivatives;
+		// pairs of (target, source) cells that interact by M2L or P2P, grouped by target into `*_offsets` and `*_sources`
+		std::vector<std::pair<id,id>> far_pairs;
+		std::vector<std::pair<id,id>> near_pairs;
+		std::vector<id> far_offsets;
+		std::vector<id> far_sources;
+		std::vector<id> near_offsets;
+		std::vector<id> near_sources;
+		std::vector<std::pair<id,id>> stack;
+
+		// applies a derivative to an offset, where derivatives of scalar fields are gradients
+		static inline auto apply(const Derivative& derivative, const vector& offset)
+		{
+			if constexpr (std::is_same_v<Derivative, vector>)
+			{
+				return glm::dot(derivative, offset);
+			}
+			else
+			{
+				return derivative * offset;
+			}
+		}
+
+		// applies a second derivative to an offset, returning the change in derivative, where second derivatives of scalar fields are Hessians
+		static inline Derivative apply(const SecondDerivative& second_derivative, const vector& offset)
+		{
+			if constexpr (std::is_same_v<Derivative, vector>)
+			{
+				return second_derivative * offset;
+			}
+			else
+			{
+				Derivative result(0);
+				for (int k = 0; k < dimension_count; ++k)
+				{
+					result += second_derivative[k] * offset[k];
+				}
+				return result;
+			}
+		}
+
+		static inline void add(SecondDerivative& out, const SecondDerivative& other)
+		{
+			if constexpr (std::is_same_v<Derivative, vector>)
+			{
+				out += other;
+			}
+			else
+			{
+				for (int k = 0; k < dimension_count; ++k)
+				{
+					out[k] += other[k];
+				}
+			}
+		}
+
+		static inline SecondDerivative zero_second_derivative()
+		{
+			if constexpr (std::is_same_v<Derivative, vector>)
+			{
+				return SecondDerivative(0);
+			}
+			else
+			{
+				SecondDerivative result;
+				result.fill(Derivative(0));
+				return result;
+			}
+		}
+
+		// the value of the local expansion of cell `a` at a given offset from its center
+		inline Value local_value(const std::size_t a, const vector& offset) const
+		{
+			return local_values[a] + apply(local_derivatives[a] + apply(local_second_derivatives[a], offset) * scalar(0.5), offset);
+		}
+
+		// stores `pairs` in compressed rows by target, where `pairs[i].second` is the source of `pairs[i].first`
+		void group(const std::vector<std::pair<id,id>>& pairs, std::vector<id>& offsets, std::vector<id>& sources) const
+		{
+			offsets.assign(tree.cells.size()+1, id(0));
+			sources.resize(pairs.size());
+			for (const auto& pair : pairs)
+			{
+				++offsets[pair.first+1];
+			}
+			for (std::size_t i = 1; i < offsets.size(); ++i)
+			{
+				offsets[i] += offsets[i-1];
+			}
+			std::vector<id> next(offsets.begin(), offsets.end()-1);
+			for (const auto& pair : pairs)
+			{
+				sources[next[pair.first]++] = pair.second;
+			}
+		}
+
+		void find_pairs()
+		{
+			const auto& cells = tree.cells;
+			far_pairs.clear();
+			near_pairs.clear();
+			stack.clear();
+			if (cells.empty())
+			{
+				return;
+			}
+			stack.emplace_back(id(0), id(0));
+			while (!stack.empty())
+			{
+				const auto [a, b] = stack.back();
+				stack.pop_back();
+				const auto& A = cells[a];
+				const auto& B = cells[b];
+				if (a == b)
+				{
+					if (A.is_leaf)
+					{
+						near_pairs.emplace_back(a, b);
+					}
+					else
+					{
+						for (id i = a+1; i < A.skip; i = cells[i].skip)
+						{
+							for (id j = a+1; j < A.skip; j = cells[j].skip)
+							{
+								stack.emplace_back(i, j);
+							}
+						}
+					}
+				}
+				else if (A.radius + B.radius < theta * glm::distance(A.center, B.center))
+				{
+					far_pairs.emplace_back(a, b);
+				}
+				else if (A.is_leaf && B.is_leaf)
+				{
+					near_pairs.emplace_back(a, b);
+				}
+				else if (!A.is_leaf && (B.is_leaf || A.radius >= B.radius))
+				{
+					for (id i = a+1; i < A.skip; i = cells[i].skip)
+					{
+						stack.emplace_back(i, b);
+					}
+				}
+				else
+				{
+					for (id j = b+1; j < B.skip; j = cells[j].skip)
+					{
+						stack.emplace_back(a, j);
+					}
+				}
+			}
+		}
+
+	public:
+
+		/*
+		`theta` is the opening angle, where 0 sums every particle directly,
+		`self_interaction_distance` is the distance below which monopoles are ignored, as in `NaiveMultipole`,
+		and `leaf_size` is the number of particles below which cells are not subdivided
+		*/
+		FastMultipole(
+			const scalar theta,
+			const scalar self_interaction_distance,
+			const id leaf_size = id(16)
+		):
+			theta(theta),
+			self_interaction_distance2_threshold(self_interaction_distance*self_interaction_distance),
+			tree(leaf_size)
+		{}
+
+		void clear()
+		{
+			tree.clear();
+		}
+
+		/*
+		`build` replaces the particles of the field with those of given `positions` and `weights`
+		*/
+		template<typename Positions, typename Weights>
+		void build(const Positions& positions, const Weights& weights)
+		{
+			tree.build(positions, weights);
+		}
+
+		/*
+		`self_values` stores in `out[i]` the value acting on the i-th particle that was given to `build()`,
+		which excludes the particle itself by virtue of `self_interaction_distance`.
+		*/
+		template<typename Out>
+		void self_values(Out& out)
+		{
+			const auto& cells = tree.cells;
+			const std::ptrdiff_t cell_count(cells.size());
+			find_pairs();
+			group(far_pairs, far_offsets, far_sources);
+			group(near_pairs, near_offsets, near_sources);
+			local_values.assign(cell_count, Multipole::zero());
+			local_derivatives.assign(cell_count, Derivative(0));
+			local_second_derivatives.assign(cell_count, zero_second_derivative());
+
+			// M2L
+			#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 64)
+			#endif
+			for (std::ptrdiff_t a = 0; a < cell_count; ++a)
+			{
+				for (id k = far_offsets[a]; k < far_offsets[a+1]; ++k)
+				{
+					const auto& B = cells[far_sources[k]];
+					const vector offset(B.center - cells[a].center);
+					if (glm::dot(offset, offset) > self_interaction_distance2_threshold)
+					{
+						local_values[a] += B.monopole.value_for_offset(offset);
+						local_derivatives[a] += B.monopole.derivative_for_offset(offset);
+						const SecondDerivative second_derivative(B.monopole.second_derivative_for_offset(offset));
+						add(local_second_derivatives[a], second_derivative);
+					}
+				}
+			}
+
+			// L2L, where parents precede their children in depth-first order
+			for (std::ptrdiff_t a = 0; a < cell_count; ++a)
+			{
+				if (!cells[a].is_leaf)
+				{
+					for (id c = a+1; c < cells[a].skip; c = cells[c].skip)
+					{
+						const vector offset(cells[c].center - cells[a].center);
+						local_values[c] += local_value(a, offset);
+						local_derivatives[c] += local_derivatives[a] + apply(local_second_derivatives[a], offset);
+						add(local_second_derivatives[c], local_second_derivatives[a]);
+					}
+				}
+			}
+
+			// evaluation and P2P
+			#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 16)
+			#endif
+			for (std::ptrdiff_t a = 0; a < cell_count; ++a)
+			{
+				const auto& A = cells[a];
+				if (!A.is_leaf)
+				{
+					continue;
+				}
+				for (id i = A.begin; i < A.end; ++i)
+				{
+					const vector& position = tree.positions[i];
+					auto value = local_value(a, position - A.center);
+					for (id k = near_offsets[a]; k < near_offsets[a+1]; ++k)
+					{
+						const auto& B = cells[near_sources[k]];
+						for (id j = B.begin; j < B.end; ++j)
+						{
+							const Multipole& particle = tree.particles[j];
+							const vector offset(tree.positions[j] - position);
+							if (glm::dot(offset, offset) > self_interaction_distance2_threshold)
+							{
+								value += particle.value_for_offset(offset);
+							}
+						}
+					}
+					out[tree.order[i]] = value;
+				}
+			}
+		}
+
+	};
+
+}
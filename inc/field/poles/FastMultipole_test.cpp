@@ -0,0 +1,86 @@
+// std libraries
+#include <cmath>    // std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "MonopoleScalar.hpp"
+#include "MonopoleVector.hpp"
+#include "QuadrupoleScalar.hpp"
+#include "QuadrupoleVector.hpp"
+#include "NaiveMultipole.hpp"
+#include "FastMultipole.hpp"
+
+TEST_CASE( "FastMultipole()", "[field]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    using Quadrupole = field::QuadrupoleVector<2, double, glm::dvec3>;
+
+    std::vector<glm::dvec3> positions;
+    std::vector<double> weights;
+    for (int i = 0; i < 3000; ++i)
+    {
+        positions.push_back(100.0 * glm::dvec3(std::sin(1.1*i), std::sin(2.3*i+0.5), std::sin(3.7*i+1.0)));
+        weights.push_back(1.0 + 10.0 * std::abs(std::sin(5.3*i)));
+    }
+
+    field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1e-3);
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        naive.add(positions[i], weights[i]);
+    }
+
+    auto relative_error = [&](const std::vector<glm::dvec3>& out){
+        double max_error(0.0);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            const glm::dvec3 expected(naive(positions[i]));
+            max_error = std::max(max_error, glm::length(out[i] - expected) / glm::length(expected));
+        }
+        return max_error;
+    };
+
+    SECTION("FastMultipole.self_values() must equal NaiveMultipole(…) at each particle when θ=0"){
+        field::FastMultipole<3, int, double, Quadrupole> exact(0.0, 1e-3);
+        exact.build(positions, weights);
+        std::vector<glm::dvec3> out(positions.size());
+        exact.self_values(out);
+        CHECK(relative_error(out) < 1e-10);
+    }
+
+    SECTION("FastMultipole.self_values() must approximate NaiveMultipole(…) at each particle when θ>0"){
+        field::FastMultipole<3, int, double, Quadrupole> fast(0.3, 1e-3);
+        fast.build(positions, weights);
+        std::vector<glm::dvec3> out(positions.size());
+        fast.self_values(out);
+        CHECK(relative_error(out) < 5e-2);
+    }
+
+    SECTION("FastMultipole.self_values() must approximate NaiveMultipole(…) for scalar fields"){
+        using PotentialMonopole = field::MonopoleScalar<1, double, glm::dvec3>;
+        using PotentialQuadrupole = field::QuadrupoleScalar<1, double, glm::dvec3>;
+        field::NaiveMultipole<double, glm::dvec3, PotentialMonopole> potential(1e-3);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            potential.add(positions[i], weights[i]);
+        }
+        field::FastMultipole<3, int, double, PotentialQuadrupole> fast(0.3, 1e-3);
+        fast.build(positions, weights);
+        std::vector<double> out(positions.size());
+        fast.self_values(out);
+        double max_error(0.0);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            const double expected(potential(positions[i]));
+            max_error = std::max(max_error, std::abs(out[i] - expected) / expected);
+        }
+        CHECK(max_error < 1e-2);
+    }
+
+}
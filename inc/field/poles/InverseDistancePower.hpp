@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cmath>
+
+namespace field
+{
+
+	/*
+	`inverse_distance_power<power>(distance2)` returns (distance²)^(-power/2), or 1/distanceᵖᵒʷᵉʳ,
+	using multiplication and at most one square root in place of `std::pow` where `power` is nonnegative
+	*/
+	template<int power, typename T>
+	inline T inverse_distance_power(const T distance2)
+	{
+		if constexpr (power < 0)
+		{
+			return std::pow(distance2, 0.5f * float(-power));
+		}
+		else
+		{
+			T result(1);
+			for (int i = 0; i < power/2; ++i)
+			{
+				result *= distance2;
+			}
+			if (power%2 != 0)
+			{
+				result *= std::sqrt(distance2);
+			}
+			return T(1)/result;
+		}
+	}
+
+}
@@ -0,0 +1,120 @@
+
+// C libraries
+#include <cmath>    // std::sin
+
+// std libraries
+#include <algorithm> // std::max
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "MonopoleVector.hpp"
+#include "QuadrupoleVector.hpp"
+#include "NaiveMultipole.hpp"
+#include "DeepBarnesHutMultipole.hpp"
+#include "LinearBarnesHutMultipole.hpp"
+#include "FastMultipole.hpp"
+
+/*
+`LinearBarnesHutMultipole_benchmark.cpp` reports the runtime of a single frame of an n-body simulation,
+where the field of every body is rebuilt and then sampled at every body, for several methods and body counts.
+Each method is also compared against direct summation for a sample of bodies, to report its largest relative error,
+since `DeepBarnesHutMultipole` only visits one cell per level and is much less accurate than the θ-criterion,
+as well as its root mean square error relative to the root mean square of the field,
+since the largest error is dominated by a few bodies and overstates the error of most bodies.
+`DeepBarnesHutMultipole` is skipped for large body counts, where it would take minutes.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`.
+*/
+
+template<typename F>
+double seconds_for(const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    using Quadrupole = field::QuadrupoleVector<2, double, glm::dvec3>;
+    const std::size_t max_deep_count(100000);
+    const std::size_t sample_count(100);
+    std::cout << "method\tcount\tbuild\tquery\tmax error\trms error" << std::endl;
+    for (std::size_t count : {1000, 10000, 100000, 1000000})
+    {
+        std::vector<glm::dvec3> positions(count);
+        std::vector<double> weights(count);
+        std::vector<glm::dvec3> out(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            positions[i] = 100.0 * glm::dvec3(std::sin(1.1*i), std::sin(2.3*i+0.5), std::sin(3.7*i+1.0));
+            weights[i] = 1.0 + std::abs(std::sin(5.3*i));
+        }
+
+        field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1e-3);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            naive.add(positions[i], weights[i]);
+        }
+        std::vector<glm::dvec3> expected(sample_count);
+        for (std::size_t j = 0; j < sample_count; ++j)
+        {
+            expected[j] = naive(positions[j*count/sample_count]);
+        }
+        auto report = [&](const std::string& method, const double build, const double query){
+            double max_error(0);
+            double error2(0);
+            double expected2(0);
+            for (std::size_t j = 0; j < sample_count; ++j)
+            {
+                const std::size_t i(j*count/sample_count);
+                max_error = std::max(max_error, glm::length(out[i]-expected[j]) / glm::length(expected[j]));
+                error2 += glm::dot(out[i]-expected[j], out[i]-expected[j]);
+                expected2 += glm::dot(expected[j], expected[j]);
+            }
+            std::cout << method << "\t" << count << "\t" << build << "\t" << query << "\t" << max_error << "\t" << std::sqrt(error2/expected2) << std::endl;
+        };
+
+        if (count <= max_deep_count)
+        {
+            field::DeepBarnesHutMultipole<3, std::size_t, double, Monopole> deep(glm::dvec3(0), 256.0, 1.0);
+            const double build = seconds_for([&](){
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    deep.add(positions[i], weights[i]);
+                }
+            });
+            const double query = seconds_for([&](){
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    out[i] = deep(positions[i]);
+                }
+            });
+            report("deep θ=n/a", build, query);
+        }
+
+        field::LinearBarnesHutMultipole<3, std::size_t, double, Monopole> linear(0.5, 1e-3);
+        const double linear_build = seconds_for([&](){ linear.build(positions, weights); });
+        const double linear_query = seconds_for([&](){ linear.self_values(out); });
+        report("linear monopole θ=0.5", linear_build, linear_query);
+
+        field::LinearBarnesHutMultipole<3, std::size_t, double, Quadrupole> quadrupole(0.5, 1e-3);
+        const double quadrupole_build = seconds_for([&](){ quadrupole.build(positions, weights); });
+        const double quadrupole_query = seconds_for([&](){ quadrupole.self_values(out); });
+        report("linear quadrupole θ=0.5", quadrupole_build, quadrupole_query);
+
+        field::FastMultipole<3, std::size_t, double, Quadrupole> fast(0.3, 1e-3);
+        const double fast_build = seconds_for([&](){ fast.build(positions, weights); });
+        const double fast_query = seconds_for([&](){ fast.self_values(out); });
+        report("fast quadrupole θ=0.3", fast_build, fast_query);
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+// std libraries
+#include <cmath>    // std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "MonopoleVector.hpp"
+#include "NaiveMultipole.hpp"
+#include "LinearBarnesHutMultipole.hpp"
+
+TEST_CASE( "LinearBarnesHutMultipole()", "[field]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+
+    std::vector<glm::dvec3> particle_positions;
+    std::vector<double> particle_weights;
+    for (int i = 0; i < 2000; ++i)
+    {
+        particle_positions.push_back(100.0 * glm::dvec3(std::sin(1.1*i), std::sin(2.3*i+0.5), std::sin(3.7*i+1.0)));
+        particle_weights.push_back(1.0 + 10.0 * std::abs(std::sin(5.3*i)));
+    }
+    std::vector<glm::dvec3> sample_positions;
+    for (int i = 0; i < 200; ++i)
+    {
+        sample_positions.push_back(200.0 * glm::dvec3(std::sin(1.7*i+0.2), std::sin(2.9*i+0.3), std::sin(4.1*i+0.4)));
+    }
+
+    field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1.0);
+    for (std::size_t i = 0; i < particle_positions.size(); ++i)
+    {
+        naive.add(particle_positions[i], particle_weights[i]);
+    }
+
+    auto relative_error = [&](const auto& field, const std::vector<glm::dvec3>& positions){
+        double max_error(0.0);
+        for (const auto& position : positions)
+        {
+            const glm::dvec3 expected(naive(position));
+            max_error = std::max(max_error, glm::length(field(position) - expected) / glm::length(expected));
+        }
+        return max_error;
+    };
+
+    SECTION("LinearBarnesHutMultipole(…) must equal NaiveMultipole(…) when θ=0"){
+        field::LinearBarnesHutMultipole<3, int, double, Monopole> exact(0.0, 1.0);
+        exact.build(particle_positions, particle_weights);
+        CHECK(relative_error(exact, sample_positions) < 1e-10);
+    }
+
+    SECTION("LinearBarnesHutMultipole(…) must approximate NaiveMultipole(…) when θ>0"){
+        field::LinearBarnesHutMultipole<3, int, double, Monopole> barnes_hut(0.3, 1.0);
+        barnes_hut.build(particle_positions, particle_weights);
+        CHECK(relative_error(barnes_hut, sample_positions) < 2e-2);
+    }
+
+    SECTION("LinearBarnesHutMultipole(positions, out) must produce the same values as LinearBarnesHutMultipole(…)"){
+        field::LinearBarnesHutMultipole<3, int, double, Monopole> barnes_hut(0.3, 1.0);
+        barnes_hut.build(particle_positions, particle_weights);
+        std::vector<glm::dvec3> out(sample_positions.size());
+        barnes_hut(sample_positions, out);
+        double max_error(0.0);
+        for (std::size_t i = 0; i < sample_positions.size(); ++i)
+        {
+            max_error = std::max(max_error, glm::length(out[i] - barnes_hut(sample_positions[i])));
+        }
+        CHECK(max_error == 0.0);
+    }
+
+    SECTION("LinearBarnesHutMultipole.self_values() must produce the same values as LinearBarnesHutMultipole(…) at each particle"){
+        field::LinearBarnesHutMultipole<3, int, double, Monopole> barnes_hut(0.3, 1.0);
+        barnes_hut.build(particle_positions, particle_weights);
+        std::vector<glm::dvec3> out(particle_positions.size());
+        barnes_hut.self_values(out);
+        double max_error(0.0);
+        for (std::size_t i = 0; i < particle_positions.size(); ++i)
+        {
+            max_error = std::max(max_error, glm::length(out[i] - barnes_hut(particle_positions[i])));
+        }
+        CHECK(max_error == 0.0);
+        CHECK(relative_error(barnes_hut, particle_positions) < 2e-2);
+    }
+
+    SECTION("LinearBarnesHutMultipole.build() must replace particles of a previous build"){
+        field::LinearBarnesHutMultipole<3, int, double, Monopole> rebuilt(0.0, 1.0);
+        rebuilt.build(sample_positions, std::vector<double>(sample_positions.size(), 3.0));
+        rebuilt.build(particle_positions, particle_weights);
+        CHECK(relative_error(rebuilt, sample_positions) < 1e-10);
+    }
+
+}
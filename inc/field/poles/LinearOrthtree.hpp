@@ -0,0 +1,290 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::floor, std::sqrt
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <cstdint>   // std::uint64_t
+
+// std libraries
+#include <algorithm> // std::min, std::max, std::partition_point
+#include <array>     // std::array
+#include <vector>    // std::vector
+
+// 3rd party libraries
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace field
+{
+
+	/*
+	`LinearOrthtree` is the orthtree that underlies `LinearBarnesHutMultipole` and `FastMultipole`.
+	It is rebuilt from all particles at once by `build()`.
+
+	Particles are sorted by the Morton key of their position within the bounding cube of all particles,
+	using a least significant digit radix sort whose histograms and scatters are distributed across OpenMP threads.
+	Every cell of the orthtree is then a contiguous range of sorted particles,
+	and cells are stored in depth-first order, so that the orthtree can be traversed without a stack:
+	the first child of a cell `i` is `i+1`, the next sibling of a cell `i` is `cells[i].skip`,
+	and the children of a cell end where the cell itself is skipped.
+	Cells are not subdivided once they hold no more than `leaf_size` particles.
+
+	`Monopole` is any of the multipole types within `field::poles`, and stores the sum of particles within a cell.
+	The multipole of a cell is expanded about its center of weight, so weights are assumed to be positive.
+	*/
+	template<int dimension_count, typename id, typename scalar, typename Monopole, glm::qualifier quality = glm::defaultp>
+	class LinearOrthtree
+	{
+
+		using vector = glm::vec<dimension_count, scalar, quality>;
+		using key = std::uint64_t;
+
+		// the number of bits of a Morton key that are used per dimension
+		static constexpr int bits_per_axis = std::min(31, 63/dimension_count);
+		static constexpr int radix_bits = 8;
+		static constexpr int radix_size = 1<<radix_bits;
+		static constexpr int radix_pass_count = (bits_per_axis*dimension_count + radix_bits-1) / radix_bits;
+
+		// scratch for the radix sort, kept between builds to avoid reallocation
+		std::vector<key> keys;
+		std::vector<key> key_scratch;
+		std::vector<id> order_scratch;
+
+		key morton_key(const vector& position, const vector& origin, const scalar width) const
+		{
+			const scalar cells_per_axis(scalar(key(1)<<bits_per_axis));
+			const key max_cell((key(1)<<bits_per_axis) - 1);
+			key result(0);
+			for (int i = 0; i < dimension_count; ++i)
+			{
+				const scalar x(std::floor((position[i]-origin[i]) / width * cells_per_axis));
+				const key cell(std::min(max_cell, key(std::max(scalar(0), x))));
+				for (int bit = 0; bit < bits_per_axis; ++bit)
+				{
+					result |= ((cell >> bit) & key(1)) << (bit*dimension_count + i);
+				}
+			}
+			return result;
+		}
+
+		/*
+		`sort` reorders `keys` and `order` by key using a stable least significant digit radix sort,
+		where each thread builds a histogram for a contiguous chunk of the input,
+		so that the scatter of each chunk can proceed independently and results do not depend on thread count
+		*/
+		void sort()
+		{
+			const std::ptrdiff_t count(keys.size());
+			key_scratch.resize(count);
+			order_scratch.resize(count);
+			#ifdef _OPENMP
+			const int thread_count(omp_get_max_threads());
+			#else
+			const int thread_count(1);
+			#endif
+			const std::ptrdiff_t chunk_size((count + thread_count - 1) / thread_count);
+			std::vector<std::array<std::ptrdiff_t,radix_size>> offsets(thread_count);
+			for (int pass = 0; pass < radix_pass_count; ++pass)
+			{
+				const int shift(pass*radix_bits);
+				#ifdef _OPENMP
+				#pragma omp parallel for
+				#endif
+				for (int thread = 0; thread < thread_count; ++thread)
+				{
+					offsets[thread].fill(0);
+					const std::ptrdiff_t end(std::min(count, (thread+1)*chunk_size));
+					for (std::ptrdiff_t i = thread*chunk_size; i < end; ++i)
+					{
+						++offsets[thread][(keys[i] >> shift) & key(radix_size-1)];
+					}
+				}
+				std::ptrdiff_t total(0);
+				for (int digit = 0; digit < radix_size; ++digit)
+				{
+					for (int thread = 0; thread < thread_count; ++thread)
+					{
+						const std::ptrdiff_t digit_count(offsets[thread][digit]);
+						offsets[thread][digit] = total;
+						total += digit_count;
+					}
+				}
+				#ifdef _OPENMP
+				#pragma omp parallel for
+				#endif
+				for (int thread = 0; thread < thread_count; ++thread)
+				{
+					const std::ptrdiff_t end(std::min(count, (thread+1)*chunk_size));
+					for (std::ptrdiff_t i = thread*chunk_size; i < end; ++i)
+					{
+						const std::ptrdiff_t j(offsets[thread][(keys[i] >> shift) & key(radix_size-1)]++);
+						key_scratch[j] = keys[i];
+						order_scratch[j] = order[i];
+					}
+				}
+				keys.swap(key_scratch);
+				order.swap(order_scratch);
+			}
+		}
+
+		/*
+		`subdivide` appends the cell for sorted particles from `begin` to `end` and all its descendants,
+		given that the particles share their Morton key above the bits of `level`,
+		and that the cube that bounds the cell has the given lowest `corner` and `width`
+		*/
+		void subdivide(const id begin, const id end, const int level, const vector& corner, const scalar width)
+		{
+			const id cell_id(cells.size());
+			cells.push_back(Cell{Monopole(), vector(0), width, scalar(0), scalar(0), id(0), begin, end, true});
+			Monopole monopole;
+			if (end-begin <= leaf_size || level >= bits_per_axis)
+			{
+				for (id i = begin; i < end; ++i)
+				{
+					monopole += particles[i];
+				}
+			}
+			else
+			{
+				cells[cell_id].is_leaf = false;
+				const int shift((bits_per_axis-1-level)*dimension_count);
+				const key orthant_mask((key(1)<<dimension_count) - 1);
+				id child_begin(begin);
+				while (child_begin < end)
+				{
+					const key orthant((keys[child_begin] >> shift) & orthant_mask);
+					const id child_end(std::partition_point(
+						keys.begin()+child_begin, keys.begin()+end,
+						[&](const key k){ return ((k >> shift) & orthant_mask) == orthant; }
+					) - keys.begin());
+					vector child_corner(corner);
+					for (int i = 0; i < dimension_count; ++i)
+					{
+						child_corner[i] += ((orthant >> i) & key(1))? width/scalar(2) : scalar(0);
+					}
+					const id child_id(cells.size());
+					subdivide(child_begin, child_end, level+1, child_corner, width/scalar(2));
+					monopole += cells[child_id].monopole;
+					child_begin = child_end;
+				}
+			}
+			Cell& cell = cells[cell_id];
+			cell.monopole = monopole;
+			cell.skip = cells.size();
+			// the center of weight is the offset from the origin to the center
+			cell.center = monopole.offset_for_position(vector(0));
+			cell.offset = glm::distance(cell.center, corner + vector(width/scalar(2)));
+			if (cell.is_leaf)
+			{
+				for (id i = begin; i < end; ++i)
+				{
+					cell.radius = std::max(cell.radius, glm::distance(positions[i], cell.center));
+				}
+			}
+			else
+			{
+				for (id child = cell_id+1; child < cell.skip; child = cells[child].skip)
+				{
+					cell.radius = std::max(cell.radius, cells[child].radius + glm::distance(cells[child].center, cell.center));
+				}
+			}
+		}
+
+	public:
+
+		struct Cell {
+			Monopole monopole;
+			// the center of weight, about which `monopole` is expanded
+			vector center;
+			// the width of the cube that bounds the cell
+			scalar width;
+			// an upper bound on the distance from `center` to any particle of the cell
+			scalar radius;
+			// the distance from `center` to the geometric center of the cube that bounds the cell
+			scalar offset;
+			// the first cell that is not a descendant of this cell
+			id skip;
+			// particles of the cell lie from `begin` to `end` within sorted particles
+			id begin;
+			id end;
+			bool is_leaf;
+		};
+
+		id leaf_size;
+		std::vector<Cell> cells;
+		// particles and their positions in sorted order
+		std::vector<Monopole> particles;
+		std::vector<vector> positions;
+		// `order[i]` is the index given to `build()` for the i-th sorted particle
+		std::vector<id> order;
+
+		explicit LinearOrthtree(const id leaf_size = id(8)):
+			leaf_size(std::max(id(1), leaf_size))
+		{}
+
+		void clear()
+		{
+			cells.clear();
+			particles.clear();
+			positions.clear();
+			order.clear();
+			keys.clear();
+		}
+
+		/*
+		`build` replaces the particles of the orthtree with those of given `positions` and `weights`
+		*/
+		template<typename Positions, typename Weights>
+		void build(const Positions& unsorted_positions, const Weights& weights)
+		{
+			clear();
+			const std::ptrdiff_t count(unsorted_positions.size());
+			if (count == 0)
+			{
+				return;
+			}
+			vector lo(unsorted_positions[0]);
+			vector hi(unsorted_positions[0]);
+			for (std::ptrdiff_t i = 0; i < count; ++i)
+			{
+				lo = glm::min(lo, vector(unsorted_positions[i]));
+				hi = glm::max(hi, vector(unsorted_positions[i]));
+			}
+			scalar width(0);
+			for (int i = 0; i < dimension_count; ++i)
+			{
+				width = std::max(width, hi[i]-lo[i]);
+			}
+			// the margin ensures that the highest position maps within the cube
+			width = width > scalar(0)? width * scalar(1.000001) : scalar(1);
+			keys.resize(count);
+			order.resize(count);
+			#ifdef _OPENMP
+			#pragma omp parallel for
+			#endif
+			for (std::ptrdiff_t i = 0; i < count; ++i)
+			{
+				keys[i] = morton_key(unsorted_positions[i], lo, width);
+				order[i] = i;
+			}
+			sort();
+			particles.resize(count);
+			positions.resize(count);
+			#ifdef _OPENMP
+			#pragma omp parallel for
+			#endif
+			for (std::ptrdiff_t i = 0; i < count; ++i)
+			{
+				positions[i] = unsorted_positions[order[i]];
+				particles[i] = Monopole(positions[i], weights[order[i]]);
+			}
+			subdivide(id(0), id(count), 0, lo, width);
+		}
+
+	};
+
+}
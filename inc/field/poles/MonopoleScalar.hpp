@@ -2,8 +2,11 @@
 
 #include <cmath>
 
+#include <glm/matrix.hpp>
 #include <glm/gtx/norm.hpp>
 
+#include "InverseDistancePower.hpp"
+
 namespace field
 {
 
@@ -50,7 +53,31 @@ namespace field
 
 	    inline auto value_for_offset(const Vector& offset) const
 	    {
-		    return weight * std::pow(glm::length2(offset), 0.5f * float(-exponent)); 
+		    return weight * inverse_distance_power<exponent>(glm::length2(offset)); 
+	    }
+
+	    /*
+	    `derivative_for_offset` returns the gradient of `value_for_offset` with respect to the position that is sampled,
+	    which is needed to construct local expansions in `FastMultipole`
+	    */
+	    inline auto derivative_for_offset(const Vector& offset) const
+	    {
+	    	using T = typename Vector::value_type;
+	    	return offset * (weight * T(exponent) * inverse_distance_power<exponent+2>(glm::length2(offset)));
+	    }
+
+	    /*
+	    `second_derivative_for_offset` returns the Hessian of `value_for_offset` with respect to the position that is sampled
+	    */
+	    inline auto second_derivative_for_offset(const Vector& offset) const
+	    {
+	    	using T = typename Vector::value_type;
+	    	using Matrix = glm::mat<Vector::length(), Vector::length(), T>;
+	    	constexpr T m = T(exponent)/T(2);
+	    	const T distance2(glm::length2(offset));
+	    	const T dh(-m * inverse_distance_power<exponent+2>(distance2));
+	    	const T ddh(m*(m+T(1)) * inverse_distance_power<exponent+4>(distance2));
+	    	return (Matrix(T(2)*dh) + glm::outerProduct(offset, offset) * (T(4)*ddh)) * T(weight);
 	    }
 
 	    static inline auto zero()
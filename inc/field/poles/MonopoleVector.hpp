@@ -1,9 +1,13 @@
 #pragma once
 
+#include <array>
 #include <cmath>
 
+#include <glm/matrix.hpp>
 #include <glm/gtx/norm.hpp>
 
+#include "InverseDistancePower.hpp"
+
 namespace field
 {
 
@@ -50,10 +54,49 @@ namespace field
 
 	    inline auto value_for_offset(const Vector& offset) const
 	    {
-		    return offset * weight * std::pow(glm::length2(offset), 0.5f * float(-exponent-1)); 
+		    return offset * weight * inverse_distance_power<exponent+1>(glm::length2(offset)); 
 		    // the incremented exponent is needed to quickly normalize the offset
 	    }
 
+	    /*
+	    `derivative_for_offset` returns the derivative of `value_for_offset` with respect to the position that is sampled,
+	    as a matrix whose columns are the derivatives along each dimension,
+	    which is needed to construct local expansions in `FastMultipole`
+	    */
+	    inline auto derivative_for_offset(const Vector& offset) const
+	    {
+	    	using T = typename Vector::value_type;
+	    	using Matrix = glm::mat<Vector::length(), Vector::length(), T>;
+	    	const T distance2(glm::length2(offset));
+	    	const T h(inverse_distance_power<exponent+1>(distance2));
+	    	return (Matrix(T(1)) - glm::outerProduct(offset, offset) * (T(exponent+1) / distance2)) * (-T(weight) * h);
+	    }
+
+	    /*
+	    `second_derivative_for_offset` returns the second derivative of `value_for_offset` with respect to the position that is sampled,
+	    as an array whose k-th element is the derivative of `derivative_for_offset` along the k-th dimension
+	    */
+	    inline auto second_derivative_for_offset(const Vector& offset) const
+	    {
+	    	using T = typename Vector::value_type;
+	    	using Matrix = glm::mat<Vector::length(), Vector::length(), T>;
+	    	constexpr T m = T(exponent+1)/T(2);
+	    	const T distance2(glm::length2(offset));
+	    	const T dh(-m * inverse_distance_power<exponent+3>(distance2));
+	    	const T ddh(m*(m+T(1)) * inverse_distance_power<exponent+5>(distance2));
+	    	const Matrix vv(glm::outerProduct(offset, offset));
+	    	std::array<Matrix, Vector::length()> result;
+	    	for (int k = 0; k < Vector::length(); ++k)
+	    	{
+	    		Vector axis(T(0));
+	    		axis[k] = T(1);
+	    		result[k] = (Matrix(T(2)*dh*offset[k]) 
+	    			+ (glm::outerProduct(axis, offset) + glm::outerProduct(offset, axis)) * (T(2)*dh) 
+	    			+ vv * (T(4)*ddh*offset[k])) * T(weight);
+	    	}
+	    	return result;
+	    }
+
 	    static inline auto zero()
 	    {
 		    return Vector(0) * Weight(0); // incremented exponent is needed to quickly normalize the offset
@@ -19,6 +19,7 @@
 #include <index/procedural/glm/VectorInterleave.hpp>
 #include <index/procedural/noise/UnitIntervalNoise.hpp>
 
+#include "MonopoleVector.hpp"
 #include "NaiveMultipole.hpp"
 
 #include <test/properties.hpp>
@@ -29,6 +30,7 @@
 TEST_CASE( "NaiveMultipole()", "[field]" ) {
     
     using vec3 = glm::dvec3;
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
 
     test::GlmAdapter<int, double> adapter(1e-5);
 
@@ -55,7 +57,7 @@ TEST_CASE( "NaiveMultipole()", "[field]" ) {
         procedural::uniform(10.0)
     );
 
-    field::NaiveMultipole<2, double, glm::dvec3> naive(1.0);
+    field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1.0);
 
     for (int i = 0; i < 200; ++i) {
         naive.add(particle_positions[i], particle_weights[i]);
@@ -75,8 +77,8 @@ TEST_CASE( "NaiveMultipole()", "[field]" ) {
         sample_positions
     ));
 
-    field::NaiveMultipole<2, double, vec3> forward(1.0);
-    field::NaiveMultipole<2, double, vec3> reverse(1.0);
+    field::NaiveMultipole<double, vec3, Monopole> forward(1.0);
+    field::NaiveMultipole<double, vec3, Monopole> reverse(1.0);
 
     for (int i = 0; i < 200; ++i) {
         forward.add(particle_positions[i], particle_weights[i]);
@@ -92,8 +94,8 @@ TEST_CASE( "NaiveMultipole()", "[field]" ) {
         sample_positions
     ));
 
-    field::NaiveMultipole<2, double, vec3> base(1.0);
-    field::NaiveMultipole<2, double, vec3> scaled(1.0);
+    field::NaiveMultipole<double, vec3, Monopole> base(1.0);
+    field::NaiveMultipole<double, vec3, Monopole> scaled(1.0);
 
     const double k = 7.0;
 
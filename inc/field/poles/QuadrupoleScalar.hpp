@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cmath>
+
+#include <glm/matrix.hpp>
+#include <glm/gtx/norm.hpp>
+
+#include "InverseDistancePower.hpp"
+
+namespace field
+{
+
+	/*
+	`QuadrupoleScalar` is a drop-in replacement for `MonopoleScalar` that also stores the second moment of its particles,
+	as described for `QuadrupoleVector`. For an offset v = c-p from a position p to the center of weight c,
+	h(s) = s^-exponent/2 and s = |v|²:
+
+		value ≈ h W + h′ tr(Q) + 2h″ (vᵀQv)
+
+	Weights are assumed to be scalars with a positive sum.
+	*/
+	template<int exponent, typename Weight, typename Vector>
+	struct QuadrupoleScalar
+	{
+
+		using T = typename Vector::value_type;
+		using Matrix = glm::mat<Vector::length(), Vector::length(), T>;
+
+		Vector weighted_position;
+		Weight weight;
+		// the second moment about the center of weight
+		Matrix central_second_moment;
+
+		QuadrupoleScalar(
+			const Vector position,
+			const Weight weight
+		): 
+			weighted_position(weight*position),
+			weight(weight),
+			central_second_moment(T(0))
+		{}
+
+		// zero constuctor
+		QuadrupoleScalar(): 
+			weighted_position(0),
+			weight(0),
+			central_second_moment(T(0))
+		{}
+
+	    inline QuadrupoleScalar<exponent,Weight,Vector>& operator+=(const QuadrupoleScalar<exponent,Weight,Vector>& other) noexcept
+	    {
+	    	if (other.weight == Weight(0))
+	    	{
+	    		return *this;
+	    	}
+	    	if (weight == Weight(0))
+	    	{
+	    		return *this = other;
+	    	}
+	    	// parallel axis theorem, where the combined center lies between both centers
+	    	const Vector separation(weighted_position/weight - other.weighted_position/other.weight);
+	    	central_second_moment += other.central_second_moment 
+	    		+ glm::outerProduct(separation, separation) * T(weight*other.weight/(weight+other.weight));
+	    	weighted_position += other.weighted_position;
+	    	weight += other.weight;
+	        return *this;
+	    }
+
+	    inline QuadrupoleScalar<exponent,Weight,Vector>& operator-=(const QuadrupoleScalar<exponent,Weight,Vector>& other) noexcept
+	    {
+	    	if (other.weight == Weight(0))
+	    	{
+	    		return *this;
+	    	}
+	    	if (weight == other.weight)
+	    	{
+	    		return *this = QuadrupoleScalar<exponent,Weight,Vector>();
+	    	}
+	    	// inverse of the parallel axis theorem within `+=`
+	    	const Weight remaining_weight(weight - other.weight);
+	    	const Vector separation((weighted_position - other.weighted_position)/remaining_weight - other.weighted_position/other.weight);
+	    	central_second_moment -= other.central_second_moment 
+	    		+ glm::outerProduct(separation, separation) * T(remaining_weight*other.weight/weight);
+	    	weighted_position -= other.weighted_position;
+	    	weight = remaining_weight;
+	        return *this;
+	    }
+
+	    inline Vector offset_for_position(const Vector& position) const
+	    {
+			Vector center_of_weight = weighted_position/weight;
+            return center_of_weight - position;
+	    }
+
+	    inline auto value_for_offset(const Vector& offset) const
+	    {
+	    	constexpr T m = T(exponent)/T(2);
+	    	const Matrix& Q(central_second_moment);
+	    	T trace(0);
+	    	for (int i = 0; i < Vector::length(); ++i)
+	    	{
+	    		trace += Q[i][i];
+	    	}
+	    	const T distance2(glm::length2(offset));
+	    	const T h(inverse_distance_power<exponent>(distance2));
+	    	const T dh(-m * inverse_distance_power<exponent+2>(distance2));
+	    	const T ddh(m*(m+T(1)) * inverse_distance_power<exponent+4>(distance2));
+		    return T(weight)*h + dh*trace + T(2)*ddh*glm::dot(offset, Q * offset);
+	    }
+
+	    /*
+	    `derivative_for_offset` returns the gradient of `value_for_offset` with respect to the position that is sampled,
+	    considering only the monopole term, as described for `QuadrupoleVector`
+	    */
+	    inline auto derivative_for_offset(const Vector& offset) const
+	    {
+	    	return offset * (T(weight) * T(exponent) * inverse_distance_power<exponent+2>(glm::length2(offset)));
+	    }
+
+	    /*
+	    `second_derivative_for_offset` returns the Hessian of `value_for_offset` with respect to the position that is sampled,
+	    considering only the monopole term
+	    */
+	    inline auto second_derivative_for_offset(const Vector& offset) const
+	    {
+	    	constexpr T m = T(exponent)/T(2);
+	    	const T distance2(glm::length2(offset));
+	    	const T dh(-m * inverse_distance_power<exponent+2>(distance2));
+	    	const T ddh(m*(m+T(1)) * inverse_distance_power<exponent+4>(distance2));
+	    	return (Matrix(T(2)*dh) + glm::outerProduct(offset, offset) * (T(4)*ddh)) * T(weight);
+	    }
+
+	    static inline auto zero()
+	    {
+		    return Weight(0);
+	    }
+
+		[[nodiscard]] constexpr inline T operator()(const Vector& position) const
+		{
+			return value_for_offset(offset_for_position(position));
+		}
+
+	};
+
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include <glm/matrix.hpp>
+#include <glm/gtx/norm.hpp>
+
+#include "InverseDistancePower.hpp"
+
+namespace field
+{
+
+	/*
+	`QuadrupoleVector` is a drop-in replacement for `MonopoleVector` that also stores the second moment of its particles,
+	so that a cell of particles within a multipole method is represented to second order:
+
+		value = Σᵢ wᵢ (xᵢ-p)/|xᵢ-p|ᵉˣᵖᵒⁿᵉⁿᵗ⁺¹
+
+	is expanded about the center of weight c, where the first moment vanishes and the second moment is
+	Q = Σᵢ wᵢ (xᵢ-c)(xᵢ-c)ᵀ. For an offset v = c-p, h(s) = s^-(exponent+1)/2 and s = |v|²:
+
+		value ≈ h W v + h′ (2Qv + v tr(Q)) + 2h″ (vᵀQv) v
+
+	The error of a cell therefore falls with the cube of its size over distance, rather than its square,
+	so multipole methods reach the same accuracy with a larger opening angle and fewer cells.
+	The second moment is stored about the center of weight and is combined using the parallel axis theorem,
+	so that precision is not lost for cells that are small compared to their distance from the origin.
+	Weights are assumed to be scalars with a positive sum.
+	*/
+	template<int exponent, typename Weight, typename Vector>
+	struct QuadrupoleVector
+	{
+
+		using T = typename Vector::value_type;
+		using Matrix = glm::mat<Vector::length(), Vector::length(), T>;
+
+		Vector weighted_position;
+		Weight weight;
+		// the second moment about the center of weight
+		Matrix central_second_moment;
+
+		QuadrupoleVector(
+			const Vector position,
+			const Weight weight
+		): 
+			weighted_position(weight*position),
+			weight(weight),
+			central_second_moment(T(0))
+		{}
+
+		// zero constuctor
+		QuadrupoleVector(): 
+			weighted_position(0),
+			weight(0),
+			central_second_moment(T(0))
+		{}
+
+	    inline QuadrupoleVector<exponent,Weight,Vector>& operator+=(const QuadrupoleVector<exponent,Weight,Vector>& other) noexcept
+	    {
+	    	if (other.weight == Weight(0))
+	    	{
+	    		return *this;
+	    	}
+	    	if (weight == Weight(0))
+	    	{
+	    		return *this = other;
+	    	}
+	    	// parallel axis theorem, where the combined center lies between both centers
+	    	const Vector separation(weighted_position/weight - other.weighted_position/other.weight);
+	    	central_second_moment += other.central_second_moment 
+	    		+ glm::outerProduct(separation, separation) * T(weight*other.weight/(weight+other.weight));
+	    	weighted_position += other.weighted_position;
+	    	weight += other.weight;
+	        return *this;
+	    }
+
+	    inline QuadrupoleVector<exponent,Weight,Vector>& operator-=(const QuadrupoleVector<exponent,Weight,Vector>& other) noexcept
+	    {
+	    	if (other.weight == Weight(0))
+	    	{
+	    		return *this;
+	    	}
+	    	if (weight == other.weight)
+	    	{
+	    		return *this = QuadrupoleVector<exponent,Weight,Vector>();
+	    	}
+	    	// inverse of the parallel axis theorem within `+=`
+	    	const Weight remaining_weight(weight - other.weight);
+	    	const Vector separation((weighted_position - other.weighted_position)/remaining_weight - other.weighted_position/other.weight);
+	    	central_second_moment -= other.central_second_moment 
+	    		+ glm::outerProduct(separation, separation) * T(remaining_weight*other.weight/weight);
+	    	weighted_position -= other.weighted_position;
+	    	weight = remaining_weight;
+	        return *this;
+	    }
+
+	    inline Vector offset_for_position(const Vector& position) const
+	    {
+			Vector center_of_weight = weighted_position/weight;
+            return center_of_weight - position;
+	    }
+
+	    inline auto value_for_offset(const Vector& offset) const
+	    {
+	    	constexpr T m = T(exponent+1)/T(2);
+	    	const Matrix& Q(central_second_moment);
+	    	T trace(0);
+	    	for (int i = 0; i < Vector::length(); ++i)
+	    	{
+	    		trace += Q[i][i];
+	    	}
+	    	const Vector Qv(Q * offset);
+	    	const T distance2(glm::length2(offset));
+	    	const T h(inverse_distance_power<exponent+1>(distance2));
+	    	const T dh(-m * inverse_distance_power<exponent+3>(distance2));
+	    	const T ddh(m*(m+T(1)) * inverse_distance_power<exponent+5>(distance2));
+		    return offset * (T(weight)*h + dh*trace + T(2)*ddh*glm::dot(offset, Qv)) + Qv * (T(2)*dh);
+	    }
+
+	    /*
+	    `derivative_for_offset` returns the derivative of `value_for_offset` with respect to the position that is sampled,
+	    as a matrix whose columns are the derivatives along each dimension.
+	    Only the monopole term is considered, since this is only needed to construct local expansions in `FastMultipole`,
+	    where the quadrupole term is of higher order.
+	    */
+	    inline auto derivative_for_offset(const Vector& offset) const
+	    {
+	    	const T distance2(glm::length2(offset));
+	    	const T h(inverse_distance_power<exponent+1>(distance2));
+	    	return (Matrix(T(1)) - glm::outerProduct(offset, offset) * (T(exponent+1) / distance2)) * (-T(weight) * h);
+	    }
+
+	    /*
+	    `second_derivative_for_offset` returns the second derivative of `value_for_offset` with respect to the position that is sampled,
+	    considering only the monopole term, as an array whose k-th element is the derivative of `derivative_for_offset` along the k-th dimension
+	    */
+	    inline auto second_derivative_for_offset(const Vector& offset) const
+	    {
+	    	constexpr T m = T(exponent+1)/T(2);
+	    	const T distance2(glm::length2(offset));
+	    	const T dh(-m * inverse_distance_power<exponent+3>(distance2));
+	    	const T ddh(m*(m+T(1)) * inverse_distance_power<exponent+5>(distance2));
+	    	const Matrix vv(glm::outerProduct(offset, offset));
+	    	std::array<Matrix, Vector::length()> result;
+	    	for (int k = 0; k < Vector::length(); ++k)
+	    	{
+	    		Vector axis(T(0));
+	    		axis[k] = T(1);
+	    		result[k] = (Matrix(T(2)*dh*offset[k]) 
+	    			+ (glm::outerProduct(axis, offset) + glm::outerProduct(offset, axis)) * (T(2)*dh) 
+	    			+ vv * (T(4)*ddh*offset[k])) * T(weight);
+	    	}
+	    	return result;
+	    }
+
+	    static inline auto zero()
+	    {
+		    return Vector(0) * Weight(0);
+	    }
+
+		[[nodiscard]] constexpr inline Vector operator()(const Vector& position) const
+		{
+			return value_for_offset(offset_for_position(position));
+		}
+
+	};
+
+}
@@ -0,0 +1,173 @@
+// std libraries
+#include <cmath>    // std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "MonopoleScalar.hpp"
+#include "MonopoleVector.hpp"
+#include "QuadrupoleScalar.hpp"
+#include "QuadrupoleVector.hpp"
+#include "NaiveMultipole.hpp"
+#include "LinearBarnesHutMultipole.hpp"
+#include "ShallowBarnesHutMultipole.hpp"
+
+TEST_CASE( "QuadrupoleVector()", "[field]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    using Quadrupole = field::QuadrupoleVector<2, double, glm::dvec3>;
+
+    // a cluster of particles about (1000,1000,1000) with an extent of roughly 1
+    std::vector<glm::dvec3> positions;
+    std::vector<double> weights;
+    for (int i = 0; i < 50; ++i)
+    {
+        positions.push_back(glm::dvec3(1000.0) + glm::dvec3(std::sin(1.1*i), 0.5*std::sin(2.3*i+0.5), 0.2*std::sin(3.7*i+1.0)));
+        weights.push_back(1.0 + std::abs(std::sin(5.3*i)));
+    }
+    std::vector<glm::dvec3> sample_positions;
+    for (int i = 0; i < 20; ++i)
+    {
+        sample_positions.push_back(glm::dvec3(1000.0) + 10.0 * glm::normalize(glm::dvec3(std::sin(1.7*i+0.2), std::sin(2.9*i+0.3), std::sin(4.1*i+0.4))));
+    }
+
+    Monopole monopole;
+    Quadrupole quadrupole;
+    field::MonopoleScalar<1, double, glm::dvec3> potential_monopole;
+    field::QuadrupoleScalar<1, double, glm::dvec3> potential_quadrupole;
+    std::vector<Quadrupole> particles;
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        monopole += Monopole(positions[i], weights[i]);
+        quadrupole += Quadrupole(positions[i], weights[i]);
+        potential_monopole += field::MonopoleScalar<1, double, glm::dvec3>(positions[i], weights[i]);
+        potential_quadrupole += field::QuadrupoleScalar<1, double, glm::dvec3>(positions[i], weights[i]);
+        particles.emplace_back(positions[i], weights[i]);
+    }
+
+    SECTION("QuadrupoleVector(…) must approximate the sum of its particles more closely than MonopoleVector(…)"){
+        double monopole_error(0.0);
+        double quadrupole_error(0.0);
+        for (const auto& position : sample_positions)
+        {
+            glm::dvec3 expected(0.0);
+            for (const auto& particle : particles)
+            {
+                expected += particle(position);
+            }
+            monopole_error = std::max(monopole_error, glm::length(monopole(position) - expected) / glm::length(expected));
+            quadrupole_error = std::max(quadrupole_error, glm::length(quadrupole(position) - expected) / glm::length(expected));
+        }
+        CHECK(quadrupole_error < 1e-3);
+        CHECK(quadrupole_error < 0.2 * monopole_error);
+    }
+
+    SECTION("QuadrupoleScalar(…) must approximate the sum of its particles more closely than MonopoleScalar(…)"){
+        double monopole_error(0.0);
+        double quadrupole_error(0.0);
+        for (const auto& position : sample_positions)
+        {
+            double expected(0.0);
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                expected += weights[i] / glm::distance(positions[i], position);
+            }
+            monopole_error = std::max(monopole_error, std::abs(potential_monopole.value_for_offset(potential_monopole.offset_for_position(position)) - expected) / expected);
+            quadrupole_error = std::max(quadrupole_error, std::abs(potential_quadrupole(position) - expected) / expected);
+        }
+        CHECK(quadrupole_error < 1e-4);
+        CHECK(quadrupole_error < 0.2 * monopole_error);
+    }
+
+    SECTION("QuadrupoleVector -= must undo QuadrupoleVector +="){
+        Quadrupole partial;
+        for (std::size_t i = 0; i < 30; ++i)
+        {
+            partial += particles[i];
+        }
+        Quadrupole difference(quadrupole);
+        for (std::size_t i = 30; i < particles.size(); ++i)
+        {
+            difference -= particles[i];
+        }
+        double max_error(0.0);
+        for (const auto& position : sample_positions)
+        {
+            max_error = std::max(max_error, glm::length(difference(position) - partial(position)) / glm::length(partial(position)));
+        }
+        CHECK(max_error < 1e-10);
+    }
+
+}
+
+TEST_CASE( "QuadrupoleVector within a Barnes-Hut multipole", "[field]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    using Quadrupole = field::QuadrupoleVector<2, double, glm::dvec3>;
+
+    std::vector<glm::dvec3> particle_positions;
+    std::vector<double> particle_weights;
+    for (int i = 0; i < 2000; ++i)
+    {
+        particle_positions.push_back(50.0 * glm::dvec3(1.0+std::sin(1.1*i), 1.0+std::sin(2.3*i+0.5), 1.0+std::sin(3.7*i+1.0)));
+        particle_weights.push_back(1.0 + 10.0 * std::abs(std::sin(5.3*i)));
+    }
+    std::vector<glm::dvec3> sample_positions;
+    for (int i = 0; i < 200; ++i)
+    {
+        sample_positions.push_back(glm::dvec3(50.0) + 100.0 * glm::dvec3(std::sin(1.7*i+0.2), std::sin(2.9*i+0.3), std::sin(4.1*i+0.4)));
+    }
+
+    // positions outside the grid of a `ShallowBarnesHutMultipole`, where its cells are distant
+    std::vector<glm::dvec3> distant_positions;
+    for (int i = 0; i < 200; ++i)
+    {
+        distant_positions.push_back(glm::dvec3(50.0) + 500.0 * glm::normalize(glm::dvec3(std::sin(1.7*i+0.2), std::sin(2.9*i+0.3), std::sin(4.1*i+0.4))));
+    }
+
+    field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1.0);
+    for (std::size_t i = 0; i < particle_positions.size(); ++i)
+    {
+        naive.add(particle_positions[i], particle_weights[i]);
+    }
+
+    auto relative_error = [&](const auto& field, const std::vector<glm::dvec3>& positions){
+        double max_error(0.0);
+        for (const auto& position : positions)
+        {
+            const glm::dvec3 expected(naive(position));
+            max_error = std::max(max_error, glm::length(field(position) - expected) / glm::length(expected));
+        }
+        return max_error;
+    };
+
+    SECTION("LinearBarnesHutMultipole<…,QuadrupoleVector> must approximate NaiveMultipole(…) more closely than LinearBarnesHutMultipole<…,MonopoleVector>"){
+        field::LinearBarnesHutMultipole<3, int, double, Monopole> monopoles(0.5, 1.0);
+        field::LinearBarnesHutMultipole<3, int, double, Quadrupole> quadrupoles(0.5, 1.0);
+        monopoles.build(particle_positions, particle_weights);
+        quadrupoles.build(particle_positions, particle_weights);
+        CHECK(relative_error(quadrupoles, sample_positions) < 0.5 * relative_error(monopoles, sample_positions));
+    }
+
+    SECTION("ShallowBarnesHutMultipole<…,QuadrupoleVector> must approximate NaiveMultipole(…) more closely than ShallowBarnesHutMultipole<…,MonopoleVector>"){
+        // `ShallowBarnesHutMultipole` omits particles of the smallest cell that contains a position,
+        // so cells are made small enough that this does not mask the error of expansions
+        field::ShallowBarnesHutMultipole<3, int, double, Monopole> monopoles(glm::dvec3(50.0), 100.0, 1.0);
+        field::ShallowBarnesHutMultipole<3, int, double, Quadrupole> quadrupoles(glm::dvec3(50.0), 100.0, 1.0);
+        for (std::size_t i = 0; i < particle_positions.size(); ++i)
+        {
+            monopoles.add(particle_positions[i], particle_weights[i]);
+            quadrupoles.add(particle_positions[i], particle_weights[i]);
+        }
+        const double monopole_error(relative_error(monopoles, distant_positions));
+        const double quadrupole_error(relative_error(quadrupoles, distant_positions));
+        CHECK(quadrupole_error < monopole_error);
+    }
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <vector>
 
 #include <glm/common.hpp>
@@ -7,6 +9,10 @@
 
 #include <grid/cartesian/OrthantIndexing.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace field
 {
 
@@ -27,6 +33,11 @@ namespace field
 	that is sufficiently shallow so as to be stored in contiguous memory as a std::vector.
 	In some cases this may allow faster retrieval than `DeepBarnesHutMultipole`
 	however it presents the risk of consuming large amounts of memory if the orthtree is too deep.
+
+	`build()` replaces all particles at once, and distributes particles across OpenMP threads when compiled with `-fopenmp`,
+	where each thread adds to its own partial orthtree and partial orthtrees are then summed cell by cell.
+	This requires an additional orthtree per thread, which is kept between builds.
+	`operator()(positions, out)` likewise distributes positions across threads.
 	*/
 	template<int dimension_count, typename id, typename scalar, typename Monopole, glm::qualifier quality = glm::defaultp>
 	class ShallowBarnesHutMultipole
@@ -46,6 +57,40 @@ namespace field
 		id cell_count;
 		std::vector<id> first_id_for_level;
 		std::vector<Monopole> orthtree;
+		// orthtrees for all but the first thread of `build()`, which adds directly to `orthtree`
+		std::vector<std::vector<Monopole>> partial_orthtrees;
+
+		/*
+		`add_to` modifies a given `tree` to also consider a particle of given `position` and `weight`
+		*/
+		template<typename Weight>
+		void add_to(std::vector<Monopole>& tree, const vector position, const Weight weight) const
+		{
+			id nesting_id(0);
+			id neighbor_id, orthant_id;
+			vector cell_center(grid_center);
+			scalar cell_width(grid_width);
+			ivector orthant;
+			for (id level = id(1); level < level_count; ++level)
+			{
+				if (!glm::any(glm::greaterThan(glm::abs(position-grid_center), vector(half*grid_width)))) {
+					orthant = ivector(glm::greaterThan(position-cell_center,vector(0)));
+					orthant_id = orthants.memory_id(orthant);
+					// add contributions to each orthant of the current level that do not contain the particle
+					for (neighbor_id = 0; neighbor_id < orthant_count; ++neighbor_id)
+					{
+						if (neighbor_id != orthant_id)
+						{
+							tree[first_id_for_level[level] + orthant_count * nesting_id + neighbor_id] 
+								+= Monopole(position, weight);
+						}
+					}
+					nesting_id = orthant_count * nesting_id + orthant_id;
+					cell_center += cell_width * (vector(orthant)-half) * half;
+					cell_width *= half;
+				}
+			}
+		}
 
 	public:
 
@@ -81,28 +126,57 @@ namespace field
 		*/
 		void add(const vector position, const auto weight)
 		{
-			id nesting_id(0);
-			id neighbor_id, orthant_id;
-			vector cell_center(grid_center);
-			scalar cell_width(grid_width);
-			ivector orthant;
-			for (id level = id(1); level < level_count; ++level)
+			add_to(orthtree, position, weight);
+		}
+
+		/*
+		`build` replaces the particles of the field with those of given `positions` and `weights`,
+		and is equivalent to calling `clear()` followed by `add()` for each particle, up to rounding
+		*/
+		template<typename Positions, typename Weights>
+		void build(const Positions& positions, const Weights& weights)
+		{
+			const std::ptrdiff_t count(positions.size());
+			#ifdef _OPENMP
+			const int thread_count(std::min(std::ptrdiff_t(omp_get_max_threads()), std::max(std::ptrdiff_t(1), count)));
+			#else
+			const int thread_count(1);
+			#endif
+			partial_orthtrees.resize(thread_count-1);
+			// the runtime may spawn fewer threads than requested, so only the partial orthtrees of spawned threads are summed
+			int spawned_count(1);
+			#ifdef _OPENMP
+			#pragma omp parallel num_threads(thread_count)
+			#endif
 			{
-				if (!glm::any(glm::greaterThan(glm::abs(position-grid_center), vector(half*grid_width)))) {
-					orthant = ivector(glm::greaterThan(position-cell_center,vector(0)));
-					orthant_id = orthants.memory_id(orthant);
-					// add contributions to each orthant of the current level that do not contain the particle
-					for (neighbor_id = 0; neighbor_id < orthant_count; ++neighbor_id)
+				#ifdef _OPENMP
+				const int thread(omp_get_thread_num());
+				#pragma omp single
+				spawned_count = omp_get_num_threads();
+				#else
+				const int thread(0);
+				#endif
+				std::vector<Monopole>& tree = thread == 0? orthtree : partial_orthtrees[thread-1];
+				tree.assign(cell_count, Monopole());
+				#ifdef _OPENMP
+				#pragma omp for schedule(static)
+				#endif
+				for (std::ptrdiff_t i = 0; i < count; ++i)
+				{
+					add_to(tree, positions[i], weights[i]);
+				}
+			}
+			if (spawned_count > 1)
+			{
+				#ifdef _OPENMP
+				#pragma omp parallel for
+				#endif
+				for (std::ptrdiff_t i = 0; i < std::ptrdiff_t(cell_count); ++i)
+				{
+					for (int thread = 1; thread < spawned_count; ++thread)
 					{
-						if (neighbor_id != orthant_id)
-						{
-							orthtree[first_id_for_level[level] + orthant_count * nesting_id + neighbor_id] 
-								+= Monopole(position, weight);
-						}
+						orthtree[i] += partial_orthtrees[thread-1][i];
 					}
-					nesting_id = orthant_count * nesting_id + orthant_id;
-					cell_center += cell_width * (vector(orthant)-half) * half;
-					cell_width *= half;
 				}
 			}
 		}
@@ -136,6 +210,22 @@ namespace field
 			return value;
 		}
 
+		/*
+		`operator()(positions, out)` is equivalent to calling `out[i] = (*this)(positions[i])` for each position
+		*/
+		template<typename Positions, typename Out>
+		void operator()(const Positions& positions, Out& out) const
+		{
+			const std::ptrdiff_t count(positions.size());
+			#ifdef _OPENMP
+			#pragma omp parallel for
+			#endif
+			for (std::ptrdiff_t i = 0; i < count; ++i)
+			{
+				out[i] = (*this)(positions[i]);
+			}
+		}
+
 	};
 
 }
@@ -1,8 +1,9 @@
 // std libraries
+#include <cmath>
 #include <limits>
 #include <string>
-#include <format>
 #include <iostream>
+#include <vector>
 
 // 3rd party libraries
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
@@ -21,6 +22,7 @@
 #include <index/procedural/glm/VectorInterleave.hpp>
 #include <index/procedural/noise/UnitIntervalNoise.hpp>
 
+#include "MonopoleVector.hpp"
 #include "NaiveMultipole.hpp"
 #include "ShallowBarnesHutMultipole.hpp"
 
@@ -32,6 +34,8 @@
 
 TEST_CASE( "ShallowBarnesHutMultipole()", "[field]" ) {
     
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+
     test::GlmAdapter<int, double> fine(1e-10);
     test::GlmAdapter<int, double> coarse(1e-5); // 1 mm accuracy
 
@@ -52,8 +56,8 @@ TEST_CASE( "ShallowBarnesHutMultipole()", "[field]" ) {
         procedural::uniform(10.0)
     );
 
-    field::NaiveMultipole<2, double, glm::dvec3> naive(1.0);
-    field::ShallowBarnesHutMultipole<3, 2, int, double> barnes_hut(
+    field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1.0);
+    field::ShallowBarnesHutMultipole<3, int, double, Monopole> barnes_hut(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
@@ -70,12 +74,12 @@ TEST_CASE( "ShallowBarnesHutMultipole()", "[field]" ) {
         sample_positions
     ));
 
-    field::ShallowBarnesHutMultipole<3, 2, int, double> forward(
+    field::ShallowBarnesHutMultipole<3, int, double, Monopole> forward(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
     );
-    field::ShallowBarnesHutMultipole<3, 2, int, double> reverse(
+    field::ShallowBarnesHutMultipole<3, int, double, Monopole> reverse(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
@@ -97,12 +101,12 @@ TEST_CASE( "ShallowBarnesHutMultipole()", "[field]" ) {
         sample_positions
     ));
 
-    field::ShallowBarnesHutMultipole<3, 2, int, double> base(
+    field::ShallowBarnesHutMultipole<3, int, double, Monopole> base(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
     );
-    field::ShallowBarnesHutMultipole<3, 2, int, double> scaled(
+    field::ShallowBarnesHutMultipole<3, int, double, Monopole> scaled(
         glm::dvec3(50.0, 50.0, 50.0),  // grid_center
         100.0,                         // grid_width
         1.0                            // min_cell_width
@@ -140,3 +144,51 @@ TEST_CASE( "ShallowBarnesHutMultipole()", "[field]" ) {
 
 }
 
+
+TEST_CASE( "ShallowBarnesHutMultipole.build()", "[field]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+
+    std::vector<glm::dvec3> particle_positions;
+    std::vector<double> particle_weights;
+    for (int i = 0; i < 1000; ++i)
+    {
+        particle_positions.push_back(50.0 * glm::dvec3(1.0+std::sin(1.1*i), 1.0+std::sin(2.3*i+0.5), 1.0+std::sin(3.7*i+1.0)));
+        particle_weights.push_back(1.0 + 10.0 * std::abs(std::sin(5.3*i)));
+    }
+    std::vector<glm::dvec3> sample_positions;
+    for (int i = 0; i < 200; ++i)
+    {
+        sample_positions.push_back(50.0 * glm::dvec3(1.0+std::sin(1.7*i+0.2), 1.0+std::sin(2.9*i+0.3), 1.0+std::sin(4.1*i+0.4)));
+    }
+
+    field::ShallowBarnesHutMultipole<3, int, double, Monopole> added(glm::dvec3(50.0), 100.0, 1.0);
+    field::ShallowBarnesHutMultipole<3, int, double, Monopole> built(glm::dvec3(50.0), 100.0, 1.0);
+    for (std::size_t i = 0; i < particle_positions.size(); ++i)
+    {
+        added.add(particle_positions[i], particle_weights[i]);
+    }
+    built.add(glm::dvec3(10.0), 1000.0);
+    built.build(particle_positions, particle_weights);
+
+    SECTION("ShallowBarnesHutMultipole.build() must produce the same field as ShallowBarnesHutMultipole.add() for each particle"){
+        double max_error(0.0);
+        for (const auto& position : sample_positions)
+        {
+            max_error = std::max(max_error, glm::length(built(position) - added(position)) / glm::length(added(position)));
+        }
+        CHECK(max_error < 1e-10);
+    }
+
+    SECTION("ShallowBarnesHutMultipole(positions, out) must produce the same values as ShallowBarnesHutMultipole(…)"){
+        std::vector<glm::dvec3> out(sample_positions.size());
+        built(sample_positions, out);
+        double max_error(0.0);
+        for (std::size_t i = 0; i < sample_positions.size(); ++i)
+        {
+            max_error = std::max(max_error, glm::length(out[i] - built(sample_positions[i])));
+        }
+        CHECK(max_error == 0.0);
+    }
+
+}
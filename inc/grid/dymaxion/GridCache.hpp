@@ -18,6 +18,10 @@ namespace dymaxion
     where doing so results in a performance gain on large grids.
     Care should be taken if using `GridCache` as a class attribute
     since its memory footprint is not trivial as with `Grid`.
+
+    Arrow attributes are stored as flat structures of arrays that are indexed by `arrow_id(source_id, offset_id)`,
+    so that operations which walk the arrows of each vertex (like those in `unlayered::VectorCalculusByFundamentalTheorem`)
+    reduce to a sequence of gathers rather than repeated calls to `Projection::sphere_position`.
     */
     template<typename id, typename id2, typename scalar, glm::qualifier precision=glm::defaultp>
 	class GridCache{
@@ -33,6 +37,11 @@ namespace dymaxion
 		std::vector<scalar> vertex_dual_areas;
 		std::vector<vec3> vertex_positions;
 		std::vector<vec3> vertex_normals;
+		std::vector<id2> vertex_representatives;
+		std::vector<id2> arrow_target_ids;
+		std::vector<vec3> arrow_normals;
+		std::vector<scalar> arrow_lengths;
+		std::vector<scalar> arrow_dual_lengths;
 
 		using coordinate_type = id;
 		using size_type = id2;
@@ -44,20 +53,40 @@ namespace dymaxion
         	grid(grid),
         	vertex_dual_areas(grid.vertex_count()),
         	vertex_positions(grid.vertex_count()),
-        	vertex_normals(grid.vertex_count())
+        	vertex_normals(grid.vertex_count()),
+        	vertex_representatives(grid.vertex_count()),
+        	arrow_target_ids(grid.arrow_count()),
+        	arrow_normals(grid.arrow_count()),
+        	arrow_lengths(grid.arrow_count()),
+        	arrow_dual_lengths(grid.arrow_count())
     	{
-    		for (int i = 0; i < grid.vertex_count(); ++i)
+    		for (id2 i = 0; i < grid.vertex_count(); ++i)
     		{
     			vertex_dual_areas[i] = grid.vertex_dual_area(i);
     		}
-    		for (int i = 0; i < grid.vertex_count(); ++i)
+    		for (id2 i = 0; i < grid.vertex_count(); ++i)
     		{
     			vertex_normals[i] = grid.vertex_normal(i);
     		}
-    		for (int i = 0; i < grid.vertex_count(); ++i)
+    		for (id2 i = 0; i < grid.vertex_count(); ++i)
     		{
     			vertex_positions[i] = grid.vertex_position(i);
     		}
+    		for (id2 i = 0; i < grid.vertex_count(); ++i)
+    		{
+    			vertex_representatives[i] = grid.vertex_representative(i);
+    		}
+    		for (id2 i = 0; i < grid.vertex_count(); ++i)
+    		{
+    			for (id2 j = 0; j < arrows_per_vertex; ++j)
+    			{
+    				const id2 k = grid.arrow_id(i,j);
+    				arrow_target_ids[k] = grid.arrow_target_id(i,j);
+    				arrow_normals[k] = grid.arrow_normal(i,j);
+    				arrow_lengths[k] = grid.arrow_length(i,j);
+    				arrow_dual_lengths[k] = grid.arrow_dual_length(i,j);
+    			}
+    		}
     	}
 
 		inline constexpr auto radius() const noexcept
@@ -87,7 +116,7 @@ namespace dymaxion
 
 		inline constexpr auto arrow_target_id(const id2 source_id, const id2 offset_id) const noexcept
 		{
-			return grid.arrow_target_id(source_id, offset_id);
+			return arrow_target_ids[grid.arrow_id(source_id, offset_id)];
 		}
 
 		inline constexpr auto arrow_target_id(const id2 arrow_id) const noexcept
@@ -159,19 +188,19 @@ namespace dymaxion
 		// normal of the arrow
 		inline constexpr auto arrow_normal(const id2 source_id, const id2 offset_id) const noexcept
 		{
-			return grid.arrow_normal(source_id, offset_id);
+			return arrow_normals[grid.arrow_id(source_id, offset_id)];
 		}
 
 		// length of the arrow
 		inline constexpr auto arrow_length(const id2 source_id, const id2 offset_id) const noexcept
 		{
-			return grid.arrow_length(source_id, offset_id);
+			return arrow_lengths[grid.arrow_id(source_id, offset_id)];
 		}
 
 		// length of the arrow's dual
 		inline constexpr auto arrow_dual_length(const id2 source_id, const id2 offset_id) const noexcept
 		{
-			return grid.arrow_dual_length(source_id, offset_id);
+			return arrow_dual_lengths[grid.arrow_id(source_id, offset_id)];
 		}
 
 		// `vertex_representative()` returns the memory id2 of a vertex
@@ -180,19 +209,17 @@ namespace dymaxion
 		// thereby providing an adequate representation for the vertex with irregular edges.
 		inline constexpr auto vertex_representative(const id2 vertex_id) const  noexcept
 		{
-			return grid.vertex_representative(vertex_id);
+			return vertex_representatives[vertex_id];
 		}
 
 		inline constexpr auto vertex_position(const id2 vertex_id) const  noexcept
 		{
 			return grid.vertex_position(vertex_id);
-			// return vertex_positions[vertex_id];
 		}
 
 		inline constexpr auto vertex_normal(const id2 vertex_id) const  noexcept
 		{
 			return grid.vertex_normal(vertex_id);
-			// return vertex_normals[vertex_id];
 		}
 
 		inline constexpr auto vertex_east(const vec3& vertex_normal, const vec3& north_pole) const  noexcept
@@ -212,7 +239,6 @@ namespace dymaxion
 
 		inline constexpr auto vertex_dual_area(const id2 vertex_id) const  noexcept
 		{
-			// return grid.vertex_dual_area(vertex_id);
 			return vertex_dual_areas[vertex_id];
 		}
 
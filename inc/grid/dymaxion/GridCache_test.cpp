@@ -0,0 +1,69 @@
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+// in-house libraries
+#include <test/macros.hpp>
+#include <test/equality.hpp>
+#include <test/glm/adapter.hpp>
+
+#include <index/procedural/Range.hpp>
+
+#include "Grid.hpp"
+#include "GridCache.hpp"
+
+TEST_CASE( "GridCache arrow properties", "[dymaxion]" ) {
+
+    double radius(2.0);
+    int vertices_per_square_side(10);
+
+    test::GlmAdapter<int,double> precise(1e-7);
+
+    dymaxion::Grid<int,int,double> grid(radius, vertices_per_square_side);
+    dymaxion::GridCache<int,int,double> cache(grid);
+
+    procedural::Range vertex_ids(grid.vertex_count());
+    procedural::Range arrow_offset_ids(4);
+
+    REQUIRE(test::equality(precise,
+        "GridCache.vertex_representative(…) must agree with the Grid it caches",
+        "GridCache.vertex_representative(…)", TEST_UNARY(cache.vertex_representative),
+        "Grid.vertex_representative(…)",      TEST_UNARY(grid.vertex_representative),
+        vertex_ids
+    ));
+
+    REQUIRE(test::equality(precise,
+        "GridCache.arrow_target_id(…) must agree with the Grid it caches",
+        "GridCache.arrow_target_id(…)", TEST_BINARY(cache.arrow_target_id),
+        "Grid.arrow_target_id(…)",      TEST_BINARY(grid.arrow_target_id),
+        vertex_ids,
+        arrow_offset_ids
+    ));
+
+    REQUIRE(test::equality(precise,
+        "GridCache.arrow_normal(…) must agree with the Grid it caches",
+        "GridCache.arrow_normal(…)", TEST_BINARY(cache.arrow_normal),
+        "Grid.arrow_normal(…)",      TEST_BINARY(grid.arrow_normal),
+        vertex_ids,
+        arrow_offset_ids
+    ));
+
+    REQUIRE(test::equality(precise,
+        "GridCache.arrow_length(…) must agree with the Grid it caches",
+        "GridCache.arrow_length(…)", TEST_BINARY(cache.arrow_length),
+        "Grid.arrow_length(…)",      TEST_BINARY(grid.arrow_length),
+        vertex_ids,
+        arrow_offset_ids
+    ));
+
+    REQUIRE(test::equality(precise,
+        "GridCache.arrow_dual_length(…) must agree with the Grid it caches",
+        "GridCache.arrow_dual_length(…)", TEST_BINARY(cache.arrow_dual_length),
+        "Grid.arrow_dual_length(…)",      TEST_BINARY(grid.arrow_dual_length),
+        vertex_ids,
+        arrow_offset_ids
+    ));
+
+}
+
@@ -0,0 +1,122 @@
+#pragma once
+
+// C libraries
+#include <cstddef>   /* std::size_t */
+
+// std libraries
+#include <vector>    /* std::vector */
+
+// 3rd party libraries
+#include <glm/vec3.hpp>
+
+// in-house libraries
+#include "Grid.hpp"
+#include "GridCache.hpp"
+#include "VertexDownsamplingIds.hpp"
+
+namespace dymaxion
+{
+
+	/*
+	`GridPyramid` owns a chain of `GridCache`s, where each level halves the `vertices_per_square_side` of the level before it.
+	`levels[0]` is the finest level, and halving stops once the side length is odd
+	or would fall below `min_vertices_per_square_side`.
+
+	Since vertices of a `dymaxion::Grid` are cell centered, every vertex of a coarse level
+	corresponds to exactly the 2×2 vertices of the finer level that `VertexDownsamplingIds` maps to it, so:
+	* `restriction` maps a fine raster to a coarse raster by averaging each 2×2 block, weighted by `vertex_dual_area`,
+	  so that the area integral of a raster is preserved
+	* `prolongation` maps a coarse raster to a fine raster by copying each coarse value to its 2×2 block
+
+	This is the scaffolding for multigrid methods, see `unlayered::PoissonMultigrid`.
+	Like `GridCache`, its memory footprint is not trivial, roughly 4/3 that of a `GridCache` for the finest level.
+	*/
+	template<typename id, typename id2, typename scalar, glm::qualifier precision=glm::defaultp>
+	class GridPyramid
+	{
+
+	public:
+
+		using Level = GridCache<id,id2,scalar,precision>;
+		using Downsampling = VertexDownsamplingIds<id,id2,scalar>;
+
+		std::vector<Level> levels;
+		// `downsamplings[i]` maps vertices of `levels[i]` to those of `levels[i+1]`
+		std::vector<Downsampling> downsamplings;
+		// `block_dual_areas[i]` stores the total dual area of `levels[i]` that is mapped to each vertex of `levels[i+1]`
+		std::vector<std::vector<scalar>> block_dual_areas;
+
+		explicit GridPyramid(const Grid<id,id2,scalar,precision> finest, const id2 min_vertices_per_square_side = 4)
+		{
+			levels.emplace_back(finest);
+			id2 side(finest.vertices_per_square_side());
+			while (side % 2 == 0 && side / 2 >= min_vertices_per_square_side)
+			{
+				side /= 2;
+				levels.emplace_back(Grid<id,id2,scalar,precision>(finest.radius(), side));
+			}
+			for (std::size_t i = 0; i+1 < levels.size(); ++i)
+			{
+				const Level& fine(levels[i]);
+				const Level& coarse(levels[i+1]);
+				downsamplings.emplace_back(fine.grid.memory, coarse.grid.memory);
+				block_dual_areas.emplace_back(coarse.vertex_count(), scalar(0));
+				for (id2 j = 0; j < fine.vertex_count(); ++j)
+				{
+					block_dual_areas[i][downsamplings[i][j]] += fine.vertex_dual_area(j);
+				}
+			}
+		}
+
+		inline std::size_t size() const
+		{
+			return levels.size();
+		}
+
+		inline const Level& operator[](const std::size_t level) const
+		{
+			return levels[level];
+		}
+
+		/*
+		`restriction` maps `fine`, a raster of `levels[level]`, to `coarse`, a raster of `levels[level+1]`
+		*/
+		template<typename Fine, typename Coarse>
+		void restriction(const std::size_t level, const Fine& fine, Coarse& coarse) const
+		{
+			using value_type = typename Coarse::value_type;
+			const Level& fine_level(levels[level]);
+			const Downsampling& downsampling(downsamplings[level]);
+			const std::vector<scalar>& block_dual_area(block_dual_areas[level]);
+			for (std::size_t j = 0; j < coarse.size(); ++j)
+			{
+				coarse[j] = value_type(0);
+			}
+			for (id2 j = 0; j < fine_level.vertex_count(); ++j)
+			{
+				coarse[downsampling[j]] += fine[j] * fine_level.vertex_dual_area(j);
+			}
+			for (std::size_t j = 0; j < coarse.size(); ++j)
+			{
+				coarse[j] /= block_dual_area[j];
+			}
+		}
+
+		/*
+		`prolongation` maps `coarse`, a raster of `levels[level+1]`, to `fine`, a raster of `levels[level]`
+		*/
+		template<typename Coarse, typename Fine>
+		void prolongation(const std::size_t level, const Coarse& coarse, Fine& fine) const
+		{
+			const Level& fine_level(levels[level]);
+			const Downsampling& downsampling(downsamplings[level]);
+			for (id2 j = 0; j < fine_level.vertex_count(); ++j)
+			{
+				fine[j] = coarse[downsampling[j]];
+			}
+		}
+
+	};
+
+}
+
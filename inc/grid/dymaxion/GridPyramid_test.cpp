@@ -0,0 +1,88 @@
+
+// std libraries
+#include <cmath>    // std::abs
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+// in-house libraries
+#include "Grid.hpp"
+#include "GridPyramid.hpp"
+
+TEST_CASE( "GridPyramid levels", "[dymaxion]" ) {
+
+    dymaxion::Grid<int,int,double> grid(2.0, 32);
+    dymaxion::GridPyramid<int,int,double> pyramid(grid);
+
+    SECTION("GridPyramid must halve vertices_per_square_side at each level until the minimum is reached"){
+        REQUIRE(pyramid.size() == 4);
+        CHECK(pyramid[0].vertices_per_square_side() == 32);
+        CHECK(pyramid[1].vertices_per_square_side() == 16);
+        CHECK(pyramid[2].vertices_per_square_side() == 8);
+        CHECK(pyramid[3].vertices_per_square_side() == 4);
+    }
+
+    SECTION("GridPyramid must stop halving once vertices_per_square_side is odd"){
+        dymaxion::GridPyramid<int,int,double> odd(dymaxion::Grid<int,int,double>(2.0, 30));
+        REQUIRE(odd.size() == 2);
+        CHECK(odd[1].vertices_per_square_side() == 15);
+    }
+
+}
+
+TEST_CASE( "GridPyramid restriction and prolongation", "[dymaxion]" ) {
+
+    dymaxion::Grid<int,int,double> grid(2.0, 32);
+    dymaxion::GridPyramid<int,int,double> pyramid(grid);
+
+    std::vector<double> fine(pyramid[0].vertex_count());
+    for (int i = 0; i < pyramid[0].vertex_count(); ++i)
+    {
+        const auto position = pyramid[0].vertex_position(i);
+        fine[i] = std::sin(3.0*position.x) + position.y*position.z;
+    }
+
+    SECTION("restriction() must preserve the area integral of a raster, to within the discretization error of either level"){
+        // 1 + z²/r² + xy integrates to 4πr²(1 + 1/3) over a sphere of radius r
+        const double radius(2.0);
+        const double pi(3.141592653589793);
+        const double exact(4.0*pi*radius*radius*(1.0 + 1.0/3.0));
+        std::vector<double> polynomial(pyramid[0].vertex_count());
+        for (int i = 0; i < pyramid[0].vertex_count(); ++i)
+        {
+            const auto position = pyramid[0].vertex_position(i);
+            polynomial[i] = 1.0 + position.z*position.z/(radius*radius) + position.x*position.y;
+        }
+        std::vector<double> coarse(pyramid[1].vertex_count());
+        pyramid.restriction(0, polynomial, coarse);
+        double fine_integral(0);
+        for (int i = 0; i < pyramid[0].vertex_count(); ++i)
+        {
+            fine_integral += polynomial[i] * pyramid[0].vertex_dual_area(i);
+        }
+        double coarse_integral(0);
+        for (int i = 0; i < pyramid[1].vertex_count(); ++i)
+        {
+            coarse_integral += coarse[i] * pyramid[1].vertex_dual_area(i);
+        }
+        CHECK(std::abs(fine_integral - exact) / exact < 1e-3);
+        CHECK(std::abs(coarse_integral - exact) / exact < 1e-3);
+    }
+
+    SECTION("restriction() must be the left inverse of prolongation()"){
+        std::vector<double> coarse(pyramid[1].vertex_count());
+        std::vector<double> prolonged(pyramid[0].vertex_count());
+        std::vector<double> restricted(pyramid[1].vertex_count());
+        pyramid.restriction(0, fine, coarse);
+        pyramid.prolongation(0, coarse, prolonged);
+        pyramid.restriction(0, prolonged, restricted);
+        for (int i = 0; i < pyramid[1].vertex_count(); ++i)
+        {
+            CHECK(std::abs(restricted[i] - coarse[i]) < 1e-9);
+        }
+    }
+
+}
+
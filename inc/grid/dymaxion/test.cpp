@@ -3,3 +3,5 @@
 #include "./Projection_test.cpp"
 #include "./Voronoi_test.cpp"
 #include "./Indexing_test.cpp"
+#include "./GridCache_test.cpp"
+#include "./GridPyramid_test.cpp"
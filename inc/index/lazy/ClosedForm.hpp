@@ -0,0 +1,87 @@
+#pragma once
+
+// std libraries
+#include <utility>   /* std::forward */
+
+// in-house libraries
+#include "Expression.hpp"
+
+namespace lazy
+{
+
+	/*
+	The following are lazy equivalents of the methods in `iterated::ClosedForm`,
+	which return an `Expression` rather than storing to an output reference parameter.
+	*/
+
+	#define LAZY_UNARY_METHOD(METHOD, NAME) \
+	template <typename In1>\
+	auto NAME (In1&& a) const\
+	{\
+		return expression([elements=elements](const auto& x){ return METHOD(x); }, std::forward<In1>(a));\
+	}
+
+	#define LAZY_BINARY_METHOD(METHOD, NAME) \
+	template <typename In1, typename In2>\
+	auto NAME (In1&& a, In2&& b) const\
+	{\
+		return expression([elements=elements](const auto& x, const auto& y){ return METHOD(x, y); }, std::forward<In1>(a), std::forward<In2>(b));\
+	}
+
+	#define LAZY_TRINARY_METHOD(METHOD, NAME) \
+	template <typename In1, typename In2, typename In3>\
+	auto NAME (In1&& a, In2&& b, In3&& c) const\
+	{\
+		return expression([elements=elements](const auto& x, const auto& y, const auto& z){ return METHOD(x, y, z); }, std::forward<In1>(a), std::forward<In2>(b), std::forward<In3>(c));\
+	}
+
+	template <typename ElementClosedForm>
+	class ClosedForm
+	{
+		const ElementClosedForm elements;
+	public:
+		ClosedForm(const ElementClosedForm& elements):
+			elements(elements)
+		{}
+		ClosedForm():
+			elements()
+		{}
+
+		LAZY_UNARY_METHOD(elements.sign,    sign)
+		LAZY_UNARY_METHOD(elements.bitsign, bitsign)
+		LAZY_UNARY_METHOD(elements.abs,     abs)
+
+		LAZY_UNARY_METHOD (elements.floor,     floor)
+		LAZY_UNARY_METHOD (elements.trunc,     trunc)
+		LAZY_UNARY_METHOD (elements.round,     round)
+		LAZY_UNARY_METHOD (elements.ceil,      ceil)
+		LAZY_UNARY_METHOD (elements.fract,     fract)
+		LAZY_BINARY_METHOD(elements.modulus,   modulus)  
+		LAZY_BINARY_METHOD(elements.floormod,  floormod)  
+		LAZY_BINARY_METHOD(elements.roundmod, roundmod)
+
+		LAZY_UNARY_METHOD(elements.sqrt, sqrt)
+		LAZY_UNARY_METHOD(elements.cbrt, cbrt)
+		LAZY_UNARY_METHOD(elements.inversesqrt, inversesqrt)
+		LAZY_BINARY_METHOD(elements.pow, pow)
+
+		LAZY_UNARY_METHOD(elements.exp,   exp)
+		LAZY_UNARY_METHOD(elements.exp2,  exp2)
+		LAZY_UNARY_METHOD(elements.exp10, exp10)
+		LAZY_UNARY_METHOD(elements.log,   log)
+		LAZY_UNARY_METHOD(elements.log2,  log2)
+		LAZY_UNARY_METHOD(elements.log10, log10)
+
+		LAZY_TRINARY_METHOD(elements.mix,        mix)  
+		LAZY_TRINARY_METHOD(elements.smoothstep, smoothstep)
+		LAZY_TRINARY_METHOD(elements.linearstep, linearstep)
+		LAZY_BINARY_METHOD(elements.step,       step) 
+
+	};
+
+	#undef LAZY_UNARY_METHOD
+	#undef LAZY_BINARY_METHOD
+	#undef LAZY_TRINARY_METHOD
+
+}
+
@@ -0,0 +1,67 @@
+#pragma once
+
+// std libraries
+#include <algorithm>   /* std::max */
+#include <cstddef>     /* std::size_t */
+#include <tuple>       /* std::tuple, std::apply */
+#include <type_traits> /* std::conditional_t, std::invoke_result_t */
+#include <utility>     /* std::forward, std::move, std::declval */
+
+namespace lazy
+{
+
+	/*
+	`Expression` is a map: (𝕋₁×…×𝕋ₙ→𝕋)×(ℕ→𝕋₁)×…×(ℕ→𝕋ₙ)⟶(ℕ→𝕋) for arbitrary types 𝕋₁…𝕋ₙ and 𝕋
+	It represents an indexible object that can participate in functions under `iterated::`, `aggregated::`, and `procedural::`.
+	The value at each index is the result of a callable object applied to the values of indexible objects at that index.
+	It is analogous to `procedural::Map`, but for any number of indexible objects,
+	and its size is the greatest size among its indexible objects, as is the size of output for functions under `iterated::`.
+
+	Nothing is calculated until an `Expression` is indexed, so expressions may be composed without storing intermediate results,
+	and the composition is calculated in a single loop once it is passed to a function such as `iterated::Identity` or `aggregated::Reduction::sum`.
+	Indexible objects are stored by reference if they were passed as lvalues, and by value otherwise,
+	so temporary expressions and `procedural::` objects may be composed freely,
+	but an expression must not outlive any named collection that it refers to.
+	*/
+	template<typename F, typename... Ins>
+	struct Expression
+	{
+		F f;
+		std::tuple<Ins...> ins;
+		// indexible objects that are stored by value are moved rather than copied, see `expression()`
+		constexpr explicit Expression(F f, Ins... ins):
+			f(std::move(f)),
+			ins(std::move(ins)...)
+		{}
+		using size_type = std::size_t;
+		using value_type = std::decay_t<std::invoke_result_t<const F&, decltype(std::declval<const std::decay_t<Ins>&>()[0])...>>;
+		constexpr inline size_type size() const
+		{
+			return std::apply([](const auto&... in){ return std::max({size_type(in.size())...}); }, ins);
+		}
+		constexpr inline auto operator()(const size_type i ) const
+		{
+			return std::apply([&](const auto&... in){ return f(in[i]...); }, ins);
+		}
+		constexpr inline auto operator[](const size_type i ) const
+		{
+			return std::apply([&](const auto&... in){ return f(in[i]...); }, ins);
+		}
+	};
+
+	// `stored` is the type by which an `Expression` stores an indexible object that was passed as type `In`
+	template<typename In>
+	using stored = std::conditional_t<std::is_lvalue_reference_v<In>, const std::remove_reference_t<In>&, std::decay_t<In>>;
+
+	/*
+	NOTE: constructing `Expression` objects can be annoying due to the number of template parameters involved,
+	so we use a convenience method, following the convention of `procedural::map`.
+	*/
+	template<typename F, typename... Ins>
+	constexpr inline Expression<F, stored<Ins>...> expression(const F& f, Ins&&... ins)
+	{
+		return Expression<F, stored<Ins>...>(f, std::forward<Ins>(ins)...);
+	}
+
+}
+
@@ -0,0 +1,95 @@
+
+// std libraries
+#include <algorithm> // std::min
+#include <chrono>   // std::chrono
+#include <cmath>    // std::sin
+#include <iostream> // std::cout
+#include <vector>   // std::vector
+
+// in-house libraries
+#include <index/adapted/symbolic/SymbolicArithmetic.hpp>
+#include <index/adapted/symbolic/SymbolicOrder.hpp>
+#include <index/iterated/Arithmetic.hpp>
+#include <index/iterated/Order.hpp>
+#include <index/iterated/Nary.hpp>
+#include <index/aggregated/Reduction.hpp>
+#include <index/procedural/Uniform.hpp>
+
+#include "Arithmetic.hpp"
+#include "Order.hpp"
+
+/*
+`Expression_benchmark.cpp` reports the runtime of a pipeline of 5 operations on a raster of 1M elements,
+max((a×b+c-d)/e, 0), either using `iterated::` with a temporary raster for each intermediate result,
+or using `lazy::` so that the pipeline is evaluated in a single loop by `iterated::Identity`.
+It also reports the runtime of summing the result, either from the output raster of `iterated::`,
+or from the `lazy::` expression directly, without storing an output raster.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`.
+*/
+
+template<typename F>
+double seconds_for(const F& f)
+{
+    double best(1e9);
+    for (int trial = 0; trial < 10; ++trial)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+int main()
+{
+    const std::size_t count(1000000);
+    const iterated::Arithmetic eager(adapted::SymbolicArithmetic{});
+    const iterated::Order eager_order(adapted::SymbolicOrder{});
+    const lazy::Arithmetic fused(adapted::SymbolicArithmetic{});
+    const lazy::Order fused_order(adapted::SymbolicOrder{});
+    const aggregated::Reduction total(adapted::SymbolicArithmetic{});
+    const iterated::Identity copy;
+    const auto zero = procedural::uniform(0.0);
+
+    std::vector<double> a(count), b(count), c(count), d(count), e(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        a[i] = std::sin(1.3*i);
+        b[i] = std::sin(2.9*i);
+        c[i] = std::sin(0.7*i);
+        d[i] = std::sin(5.1*i);
+        e[i] = 2.0 + std::sin(3.7*i);
+    }
+    std::vector<double> product(count), sum(count), difference(count), quotient(count);
+    std::vector<double> eager_out(count), fused_out(count);
+    double eager_total(0.0), fused_total(0.0);
+
+    auto pipeline = [&](){
+        eager.multiply(a, b, product);
+        eager.add(product, c, sum);
+        eager.subtract(sum, d, difference);
+        eager.divide(difference, e, quotient);
+        eager_order.max(quotient, zero, eager_out);
+    };
+    auto expression = [&](){
+        return fused_order.max(fused.divide(fused.subtract(fused.add(fused.multiply(a, b), c), d), e), zero);
+    };
+
+    const double eager_seconds = seconds_for(pipeline);
+    const double fused_seconds = seconds_for([&](){ copy(expression(), fused_out); });
+    const double eager_total_seconds = seconds_for([&](){ pipeline(); eager_total = total.sum(eager_out, 0.0); });
+    const double fused_total_seconds = seconds_for([&](){ fused_total = total.sum(expression(), 0.0); });
+
+    double difference_max(0.0);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        difference_max = std::max(difference_max, std::abs(eager_out[i] - fused_out[i]));
+    }
+
+    std::cout << "count\teager\tfused\tspeedup\teager sum\tfused sum\tspeedup\tdifference" << std::endl;
+    std::cout << count << "\t" << eager_seconds << "\t" << fused_seconds << "\t" << eager_seconds/fused_seconds << "\t"
+        << eager_total_seconds << "\t" << fused_total_seconds << "\t" << eager_total_seconds/fused_total_seconds << "\t"
+        << std::max(difference_max, std::abs(eager_total - fused_total)) << std::endl;
+    return 0;
+}
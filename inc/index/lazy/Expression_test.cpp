@@ -0,0 +1,170 @@
+
+// std libraries
+#include <cmath>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+// in-house libraries
+#include <index/adapted/symbolic/SymbolicArithmetic.hpp>
+#include <index/adapted/symbolic/SymbolicOrder.hpp>
+#include <index/iterated/Arithmetic.hpp>
+#include <index/iterated/Order.hpp>
+#include <index/iterated/Nary.hpp>
+#include <index/aggregated/Reduction.hpp>
+#include <index/procedural/Uniform.hpp>
+
+#include "Expression.hpp"
+#include "Arithmetic.hpp"
+#include "Order.hpp"
+#include "Nary.hpp"
+
+namespace {
+    const std::vector<double> a {1.0, -2.0, 3.0, -4.0, 5.0, 0.5};
+    const std::vector<double> b {2.0,  2.0, -1.0, 0.25, 3.0, 4.0};
+    const std::vector<double> c {0.0,  1.0, 2.0,  3.0,  4.0, 5.0};
+
+    bool equal(const std::vector<double>& x, const std::vector<double>& y)
+    {
+        if (x.size() != y.size()) { return false; }
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            if (std::abs(x[i] - y[i]) > 1e-12) { return false; }
+        }
+        return true;
+    }
+}
+
+TEST_CASE( "lazy::expression()", "[lazy]" ) {
+    auto sum = lazy::expression([](double x, double y){ return x + y; }, a, b);
+    SECTION("An expression must report the greatest size of its indexible objects"){
+        CHECK(sum.size() == a.size());
+        CHECK(lazy::expression([](double x, double y){ return x * y; }, a, procedural::uniform(2.0)).size() == a.size());
+    }
+    SECTION("An expression must store the values of its callable object at each index"){
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            CHECK(sum[i] == a[i] + b[i]);
+            CHECK(sum(i) == a[i] + b[i]);
+        }
+    }
+    SECTION("An expression must refer to indexible objects that were passed as lvalues rather than copy them"){
+        std::vector<double> x(a);
+        auto twice = lazy::expression([](double y){ return 2.0 * y; }, x);
+        x[0] = 10.0;
+        CHECK(twice[0] == 20.0);
+    }
+    SECTION("An expression must move indexible objects that were passed as rvalues rather than copy them"){
+        std::vector<double> x(a);
+        const double* data(x.data());
+        auto twice = lazy::expression([](double y){ return 2.0 * y; }, std::move(x));
+        CHECK(std::get<0>(twice.ins).data() == data);
+        CHECK(twice[0] == 2.0 * a[0]);
+    }
+}
+
+TEST_CASE( "lazy::Arithmetic", "[lazy]" ) {
+    iterated::Arithmetic eager(adapted::SymbolicArithmetic{});
+    lazy::Arithmetic fused(adapted::SymbolicArithmetic{});
+    iterated::Identity copy;
+    std::vector<double> expected(a.size());
+    std::vector<double> temporary(a.size());
+    std::vector<double> out(a.size());
+    SECTION("Evaluating a lazy operation must produce the same result as its eager equivalent"){
+        eager.add(a, b, expected);
+        copy(fused.add(a, b), out);
+        CHECK(equal(out, expected));
+        eager.divide(a, b, expected);
+        copy(fused.divide(a, b), out);
+        CHECK(equal(out, expected));
+    }
+    SECTION("Evaluating nested lazy operations must produce the same result as the eager equivalent that stores to temporaries"){
+        eager.multiply(a, b, temporary);
+        eager.subtract(temporary, c, expected);
+        copy(fused.subtract(fused.multiply(a, b), c), out);
+        CHECK(equal(out, expected));
+    }
+    SECTION("Lazy operations must accept `procedural::` objects"){
+        eager.multiply(a, procedural::uniform(3.0), expected);
+        copy(fused.multiply(a, procedural::uniform(3.0)), out);
+        CHECK(equal(out, expected));
+    }
+}
+
+TEST_CASE( "lazy::Order", "[lazy]" ) {
+    iterated::Order eager(adapted::SymbolicOrder{});
+    lazy::Order fused(adapted::SymbolicOrder{});
+    iterated::Identity copy;
+    std::vector<double> expected(a.size());
+    std::vector<double> out(a.size());
+    SECTION("Evaluating a lazy operation must produce the same result as its eager equivalent"){
+        eager.max(a, b, expected);
+        copy(fused.max(a, b), out);
+        CHECK(equal(out, expected));
+        eager.clamp(a, procedural::uniform(-1.0), procedural::uniform(1.0), expected);
+        copy(fused.clamp(a, procedural::uniform(-1.0), procedural::uniform(1.0)), out);
+        CHECK(equal(out, expected));
+    }
+}
+
+TEST_CASE( "lazy::Ternary", "[lazy]" ) {
+    iterated::Ternary eager;
+    lazy::Ternary fused;
+    lazy::Order order(adapted::SymbolicOrder{});
+    iterated::Identity copy;
+    std::vector<bool> condition(a.size());
+    std::vector<double> expected(a.size());
+    std::vector<double> out(a.size());
+    SECTION("Evaluating a lazy operation must produce the same result as its eager equivalent"){
+        copy(order.greater_than(a, b), condition);
+        eager(condition, a, b, expected);
+        copy(fused(order.greater_than(a, b), a, b), out);
+        CHECK(equal(out, expected));
+    }
+}
+
+TEST_CASE( "lazy::Index", "[lazy]" ) {
+    iterated::Index eager;
+    lazy::Index fused;
+    iterated::Identity copy;
+    const std::vector<unsigned int> indices {5, 4, 3, 2, 1, 0};
+    std::vector<double> expected(a.size());
+    std::vector<double> out(a.size());
+    SECTION("Evaluating a lazy operation must produce the same result as its eager equivalent"){
+        eager(a, indices, expected);
+        copy(fused(a, indices), out);
+        CHECK(equal(out, expected));
+        copy(fused(std::vector<double>(a), indices), out);
+        CHECK(equal(out, expected));
+    }
+}
+
+TEST_CASE( "lazy::Binary", "[lazy]" ) {
+    auto hypot = [](double x, double y){ return std::sqrt(x*x + y*y); };
+    iterated::Binary eager(hypot);
+    lazy::Binary fused(hypot);
+    iterated::Identity copy;
+    std::vector<double> expected(a.size());
+    std::vector<double> out(a.size());
+    SECTION("Evaluating a lazy operation must produce the same result as its eager equivalent"){
+        eager(a, b, expected);
+        copy(fused(a, b), out);
+        CHECK(equal(out, expected));
+    }
+}
+
+TEST_CASE( "lazy expressions within aggregated::", "[lazy]" ) {
+    iterated::Arithmetic eager(adapted::SymbolicArithmetic{});
+    lazy::Arithmetic fused(adapted::SymbolicArithmetic{});
+    aggregated::Reduction total(adapted::SymbolicArithmetic{});
+    std::vector<double> temporary(a.size());
+    SECTION("Aggregating a lazy operation must produce the same result as aggregating its eager equivalent"){
+        eager.multiply(a, b, temporary);
+        CHECK(std::abs(total.sum(fused.multiply(a, b), 0.0) - total.sum(temporary, 0.0)) < 1e-12);
+    }
+}
+
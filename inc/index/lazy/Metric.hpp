@@ -0,0 +1,59 @@
+#pragma once
+
+// std libraries
+#include <utility>   /* std::forward */
+
+// in-house libraries
+#include "Expression.hpp"
+
+namespace lazy
+{
+
+	/*
+	The following are lazy equivalents of the methods in `iterated::Metric`,
+	which return an `Expression` rather than storing to an output reference parameter.
+	*/
+
+	#define LAZY_UNARY_METHOD(METHOD, NAME) \
+	template <typename In1>\
+	auto NAME (In1&& a) const\
+	{\
+		return expression([elements=elements](const auto& x){ return METHOD(x); }, std::forward<In1>(a));\
+	}
+
+	#define LAZY_BINARY_METHOD(METHOD, NAME) \
+	template <typename In1, typename In2>\
+	auto NAME (In1&& a, In2&& b) const\
+	{\
+		return expression([elements=elements](const auto& x, const auto& y){ return METHOD(x, y); }, std::forward<In1>(a), std::forward<In2>(b));\
+	}
+
+	#define LAZY_TRINARY_METHOD(METHOD, NAME) \
+	template <typename In1, typename In2, typename In3>\
+	auto NAME (In1&& a, In2&& b, In3&& c) const\
+	{\
+		return expression([elements=elements](const auto& x, const auto& y, const auto& z){ return METHOD(x, y, z); }, std::forward<In1>(a), std::forward<In2>(b), std::forward<In3>(c));\
+	}
+
+	template <typename ElementMetric>
+	class Metric
+	{
+		const ElementMetric elements;
+	public:
+		Metric(const ElementMetric& elements):
+			elements(elements)
+		{}
+		Metric():
+			elements()
+		{}
+		LAZY_BINARY_METHOD(elements.distance,   distance)
+		LAZY_UNARY_METHOD(elements.normalize,  normalize)
+		LAZY_UNARY_METHOD(elements.length,     length)
+	};
+
+	#undef LAZY_UNARY_METHOD
+	#undef LAZY_BINARY_METHOD
+	#undef LAZY_TRINARY_METHOD
+
+}
+
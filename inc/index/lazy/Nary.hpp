@@ -0,0 +1,91 @@
+#pragma once
+
+// std libraries
+#include <type_traits> /* std::is_lvalue_reference_v */
+#include <utility>     /* std::forward, std::move */
+
+// in-house libraries
+#include "Expression.hpp"
+
+namespace lazy
+{
+
+	/*
+	The following are lazy equivalents of the classes in `iterated::`'s `Nary.hpp`,
+	which return an `Expression` rather than storing to an output reference parameter.
+	An `Expression` is evaluated by passing it to `iterated::Identity`, or to any function that accepts an indexible object.
+	*/
+
+	struct Ternary // A.K.A. `CopyIf`
+	{
+		Ternary(){}
+		template <typename Condition, typename If, typename Else>
+		auto operator() (Condition&& condition, If&& if_, Else&& else_) const
+		{
+			return expression([](const auto& c, const auto& x, const auto& y){ return c? x : y; }, 
+				std::forward<Condition>(condition), std::forward<If>(if_), std::forward<Else>(else_));
+		}
+	};
+
+	struct Index
+	{
+		Index(){}
+		template <typename F, typename In1>
+		auto operator() (F&& f, In1&& a) const
+		{
+			// like indexible objects, `f` is stored by reference if it was passed as an lvalue, and by value otherwise
+			if constexpr (std::is_lvalue_reference_v<F>)
+			{
+				return expression([&f](const auto& x){ return f[x]; }, std::forward<In1>(a));
+			}
+			else
+			{
+				return expression([f=std::move(f)](const auto& x){ return f[x]; }, std::forward<In1>(a));
+			}
+		}
+	};
+
+	template <typename F>
+	class Unary
+	{
+		const F f;
+	public:
+		Unary(const F& f): f(f) {}
+		Unary(): f() {}
+		template <typename In1>
+		auto operator() (In1&& a) const
+		{
+			return expression(f, std::forward<In1>(a));
+		}
+	};
+
+	template <typename F>
+	class Binary
+	{
+		const F f;
+	public:
+		Binary(const F& f): f(f) {}
+		Binary(): f() {}
+		template <typename In1, typename In2>
+		auto operator() (In1&& a, In2&& b) const
+		{
+			return expression(f, std::forward<In1>(a), std::forward<In2>(b));
+		}
+	};
+
+	template <typename F>
+	class Trinary
+	{
+		const F f;
+	public:
+		Trinary(const F& f): f(f) {}
+		Trinary(): f() {}
+		template <typename In1, typename In2, typename In3>
+		auto operator() (In1&& a, In2&& b, In3&& c) const
+		{
+			return expression(f, std::forward<In1>(a), std::forward<In2>(b), std::forward<In3>(c));
+		}
+	};
+
+}
+
@@ -0,0 +1,77 @@
+#pragma once
+
+// std libraries
+#include <utility>   /* std::forward */
+
+// in-house libraries
+#include "Expression.hpp"
+
+namespace lazy
+{
+
+	/*
+	The following are lazy equivalents of the methods in `iterated::Trigonometry`,
+	which return an `Expression` rather than storing to an output reference parameter.
+	*/
+
+	#define LAZY_UNARY_METHOD(METHOD, NAME) \
+	template <typename In1>\
+	auto NAME (In1&& a) const\
+	{\
+		return expression([elements=elements](const auto& x){ return METHOD(x); }, std::forward<In1>(a));\
+	}
+
+	#define LAZY_BINARY_METHOD(METHOD, NAME) \
+	template <typename In1, typename In2>\
+	auto NAME (In1&& a, In2&& b) const\
+	{\
+		return expression([elements=elements](const auto& x, const auto& y){ return METHOD(x, y); }, std::forward<In1>(a), std::forward<In2>(b));\
+	}
+
+	#define LAZY_TRINARY_METHOD(METHOD, NAME) \
+	template <typename In1, typename In2, typename In3>\
+	auto NAME (In1&& a, In2&& b, In3&& c) const\
+	{\
+		return expression([elements=elements](const auto& x, const auto& y, const auto& z){ return METHOD(x, y, z); }, std::forward<In1>(a), std::forward<In2>(b), std::forward<In3>(c));\
+	}
+
+	template <typename ElementTrigonometry>
+	class Trigonometry
+	{
+		const ElementTrigonometry elements;
+	public:
+		Trigonometry(const ElementTrigonometry& elements):
+			elements(elements)
+		{}
+		Trigonometry():
+			elements()
+		{}
+		LAZY_UNARY_METHOD(elements.sin, sin)
+		LAZY_UNARY_METHOD(elements.cos, cos)
+		LAZY_UNARY_METHOD(elements.tan, tan)
+		LAZY_UNARY_METHOD(elements.asinh, asinh)
+		LAZY_UNARY_METHOD(elements.acosh, acosh)
+		LAZY_UNARY_METHOD(elements.atanh, atanh)
+		LAZY_UNARY_METHOD(elements.sec, sec)
+		LAZY_UNARY_METHOD(elements.csc, csc)
+		LAZY_UNARY_METHOD(elements.cot, cot)
+		LAZY_UNARY_METHOD(elements.sinh, sinh)
+		LAZY_UNARY_METHOD(elements.cosh, cosh)
+		LAZY_UNARY_METHOD(elements.tanh, tanh)
+		// LAZY_UNARY_METHOD(elements.asec, asec)
+		// LAZY_UNARY_METHOD(elements.acsc, acsc)
+		// LAZY_UNARY_METHOD(elements.acot, acot)
+		// LAZY_UNARY_METHOD(elements.asech, asech)
+		// LAZY_UNARY_METHOD(elements.acsch, acsch)
+		// LAZY_UNARY_METHOD(elements.acoth, acoth)
+		LAZY_UNARY_METHOD(elements.radians, radians)
+		LAZY_UNARY_METHOD(elements.degrees, degrees)
+		LAZY_BINARY_METHOD(elements.atan2, atan2)
+	};
+
+	#undef LAZY_UNARY_METHOD
+	#undef LAZY_BINARY_METHOD
+	#undef LAZY_TRINARY_METHOD
+
+}
+
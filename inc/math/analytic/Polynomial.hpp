@@ -1563,7 +1563,7 @@ namespace analytic {
     {
         return 
             higher_order_derivative<N>(pow<N>(Identity<T>()*Identity<T>()-T(1))) / 
-            (std::pow(T(2),T(N)) * combinatoric::factorial(N));
+            (std::pow(T(2),T(N)) * combinatoric::factorial(T(N)));
     }
 
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>         // std::clamp
+
 #include <glm/vec3.hpp>      // *vec3
 #include <glm/geometric.hpp> // length
 
@@ -54,6 +56,23 @@ namespace geometric
       return glm::length(point-origin) < radius;
     }
     /*
+    `is_intersected_by_line_segment` returns whether the line segment from `a` to `b` passes within `radius` of `origin`,
+    e.g. to determine whether a body occludes light that travels between two other bodies
+    */
+    template<glm::qualifier quality=glm::defaultp>
+    bool is_intersected_by_line_segment(
+      const glm::vec<L,scalar,quality> a, 
+      const glm::vec<L,scalar,quality> b, 
+      const glm::vec<L,scalar,quality> origin, 
+      const scalar radius
+    ) const {
+      const glm::vec<L,scalar,quality> ab = b-a;
+      const scalar ab2 = glm::dot(ab,ab);
+      const scalar t = ab2 > scalar(0)? std::clamp(glm::dot(origin-a, ab) / ab2, scalar(0), scalar(1)) : scalar(0);
+      const glm::vec<L,scalar,quality> nearest = a + t*ab - origin;
+      return glm::dot(nearest,nearest) < radius*radius;
+    }
+    /*
     template<typename scalar, glm::qualifier quality=glm::defaultp>
     maybe_range distance_to_surface_along_line(
       const glm::vec<L,scalar,quality> reference, 
@@ -5,7 +5,7 @@ namespace light{
     template<typename Irradiance, typename Temperature>
     class BlackBodyDirectionalSource{
 
-        Irradiance irradiance;
+        Irradiance irradiance_;
         Temperature temperature;
 
     public:
@@ -14,14 +14,14 @@ namespace light{
             const Irradiance irradiance,
             const Temperature temperature
         ): 
-            irradiance(irradiance),
+            irradiance_(irradiance),
             temperature(temperature)
         {}
 
         Irradiance irradiance() const
         {
             // TODO: return an array of power for wavelength bins according to Wein's law.
-            return irradiance;
+            return irradiance_;
         }
 
     };
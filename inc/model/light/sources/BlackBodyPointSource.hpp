@@ -5,7 +5,7 @@ namespace light{
     template<typename Power, typename Temperature>
     class BlackBodyPointSource{
 
-        Power luminosity;
+        Power luminosity_;
         Temperature temperature;
 
     public:
@@ -14,14 +14,14 @@ namespace light{
             const Power luminosity,
             const Temperature temperature
         ): 
-            luminosity(luminosity),
+            luminosity_(luminosity),
             temperature(temperature)
         {}
 
         Power luminosity() const
         {
             // TODO: return an array of power for wavelength bins according to Wein's law.
-            return luminosity;
+            return luminosity_;
         }
     };
 
@@ -5,7 +5,7 @@ namespace light{
     template<typename Power, typename Temperature, typename Radius>
     class BlackBodySphereSource{
 
-        Power luminosity;
+        Power luminosity_;
         Temperature temperature;
         Radius radius;
 
@@ -16,7 +16,7 @@ namespace light{
             const Temperature temperature,
             const Radius radius
         ): 
-            luminosity(luminosity),
+            luminosity_(luminosity),
             temperature(temperature),
             radius(radius)
         {}
@@ -24,7 +24,7 @@ namespace light{
         Power luminosity() const
         {
             // TODO: return an array of power for wavelength bins according to Wein's law.
-            return luminosity;
+            return luminosity_;
         }
     };
 
@@ -0,0 +1,164 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::sqrt, std::log2, std::ceil
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+
+// std libraries
+#include <algorithm> // std::clamp
+#include <vector>    // std::vector
+
+// 3rd party libraries
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "KickDrift.hpp"
+#include "FieldAccelerations.hpp"
+
+namespace nbody
+{
+
+	/*
+	`BlockLeapfrog` advances bodies using the kick-drift-kick leapfrog of `Leapfrog`,
+	but where each body takes its own timestep from a hierarchy of "block" timesteps, as in GADGET or the Aarseth codes.
+	A body at level k takes steps of dt/2ᵏ, where dt is given to `step()` and k is at most `max_level`,
+	so that a body in a tight orbit can take many small steps while the remaining bodies take few large ones.
+
+	The level of a body is the smallest whose timestep does not exceed η√(ε/|a|),
+	where η is `accuracy`, ε is `softening`, and a is the acceleration of the body.
+	A body may move to a finer level at the end of any of its steps, but only to a coarser level where the two levels are synchronized,
+	and every body is synchronized at the start and end of each call to `step()`, when levels are chosen afresh.
+
+	Every body drifts on every substep of dt/2ᵐᵃˣ⁻ˡᵉᵛᵉˡ, which is cheap,
+	but the field is only evaluated at the bodies whose steps end on that substep, which are stored in `active`.
+	The field must still be rebuilt from every body on each such substep,
+	so the savings are greatest for fields that are cheap to build and expensive to evaluate, such as `LinearBarnesHutMultipole`.
+	Since levels are not fixed, the method is not strictly symplectic, but energy error remains bounded in practice.
+	`reset()` must be called if bodies are modified outside of `step()`.
+	*/
+	template<typename scalar, typename vector>
+	class BlockLeapfrog
+	{
+
+		int max_level;
+		scalar accuracy;
+		scalar softening;
+		std::vector<vector> accelerations;
+		std::vector<int> levels;
+		std::vector<std::size_t> active;
+		bool is_current;
+
+		int level_for_acceleration(const vector& acceleration, const scalar dt) const
+		{
+			const scalar magnitude(glm::length(acceleration));
+			if (!(magnitude > scalar(0)))
+			{
+				return 0;
+			}
+			const scalar ideal(accuracy * std::sqrt(softening/magnitude));
+			return std::clamp(int(std::ceil(std::log2(dt/ideal))), 0, max_level);
+		}
+
+		// the number of substeps in a step of a given level
+		inline long substeps_for_level(const int level) const
+		{
+			return 1L << (max_level-level);
+		}
+
+	public:
+
+		BlockLeapfrog(
+			const int max_level,
+			const scalar accuracy,
+			const scalar softening
+		):
+			max_level(max_level),
+			accuracy(accuracy),
+			softening(softening),
+			accelerations(),
+			levels(),
+			active(),
+			is_current(false)
+		{}
+
+		void reset()
+		{
+			is_current = false;
+		}
+
+		// the level of the i-th body during the last call to `step()`, for diagnostics
+		inline int level(const std::size_t i) const
+		{
+			return levels[i];
+		}
+
+		template<typename Field, typename Positions, typename Velocities, typename Weights>
+		void step(Field& field, Positions& positions, Velocities& velocities, const Weights& weights, const scalar dt)
+		{
+			const std::ptrdiff_t count(positions.size());
+			if (!is_current || accelerations.size() != positions.size())
+			{
+				accelerations.resize(count);
+				field_accelerations(field, positions, weights, accelerations);
+				is_current = true;
+			}
+			levels.resize(count);
+			for (std::ptrdiff_t i = 0; i < count; ++i)
+			{
+				levels[i] = level_for_acceleration(accelerations[i], dt);
+			}
+			const long substep_count(substeps_for_level(0));
+			const scalar substep(dt/scalar(substep_count));
+			for (long s = 0; s < substep_count; ++s)
+			{
+				// opening half kicks for bodies whose steps start on this substep
+				#ifdef _OPENMP
+				#pragma omp parallel for
+				#endif
+				for (std::ptrdiff_t i = 0; i < count; ++i)
+				{
+					const long stride(substeps_for_level(levels[i]));
+					if (s % stride == 0)
+					{
+						velocities[i] += accelerations[i] * (substep*scalar(stride)/scalar(2));
+					}
+				}
+				drift(positions, velocities, substep);
+				// closing half kicks for bodies whose steps end on this substep
+				active.clear();
+				for (std::ptrdiff_t i = 0; i < count; ++i)
+				{
+					if ((s+1) % substeps_for_level(levels[i]) == 0)
+					{
+						active.push_back(i);
+					}
+				}
+				if (active.empty())
+				{
+					continue;
+				}
+				field_accelerations(field, positions, weights, active, accelerations);
+				const std::ptrdiff_t active_count(active.size());
+				#ifdef _OPENMP
+				#pragma omp parallel for
+				#endif
+				for (std::ptrdiff_t j = 0; j < active_count; ++j)
+				{
+					const std::size_t i(active[j]);
+					velocities[i] += accelerations[i] * (substep*scalar(substeps_for_level(levels[i]))/scalar(2));
+					const int ideal(level_for_acceleration(accelerations[i], dt));
+					if (ideal > levels[i])
+					{
+						levels[i] = ideal;
+					}
+					while (levels[i] > ideal && (s+1) % substeps_for_level(levels[i]-1) == 0)
+					{
+						--levels[i];
+					}
+				}
+			}
+		}
+
+	};
+
+}
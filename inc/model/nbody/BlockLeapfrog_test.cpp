@@ -0,0 +1,109 @@
+
+// std libraries
+#include <cmath>    // std::cos, std::sin, std::sqrt
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include <field/poles/MonopoleVector.hpp>
+#include <field/poles/QuadrupoleVector.hpp>
+#include <field/poles/NaiveMultipole.hpp>
+#include <field/poles/LinearBarnesHutMultipole.hpp>
+
+#include "Leapfrog.hpp"
+#include "BlockLeapfrog.hpp"
+
+TEST_CASE( "BlockLeapfrog.step()", "[nbody]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    field::NaiveMultipole<double, glm::dvec3, Monopole> gravity(1e-6);
+
+    // massless bodies in circular orbits of radius 0.1 and 2 about a body of unit mass, in units where G=1
+    const std::vector<double> weights{1.0, 0.0, 0.0};
+    const std::vector<double> radii{0.0, 0.1, 2.0};
+    std::vector<glm::dvec3> initial_positions;
+    std::vector<glm::dvec3> initial_velocities;
+    for (double radius : radii)
+    {
+        initial_positions.push_back(glm::dvec3(radius, 0, 0));
+        initial_velocities.push_back(glm::dvec3(0, radius > 0.0? std::sqrt(1.0/radius) : 0.0, 0));
+    }
+    auto orbit_error = [&](const std::vector<glm::dvec3>& positions, const std::size_t i, const double t){
+        const double radius(radii[i]);
+        const double angular_speed(std::sqrt(1.0/(radius*radius*radius)));
+        return glm::distance(positions[i], radius * glm::dvec3(std::cos(angular_speed*t), std::sin(angular_speed*t), 0));
+    };
+    const double dt(0.05);
+    const int step_count(20);
+
+    SECTION("BlockLeapfrog.step() must equal Leapfrog.step() when there is only one level"){
+        auto positions = initial_positions;
+        auto velocities = initial_velocities;
+        auto block_positions = initial_positions;
+        auto block_velocities = initial_velocities;
+        nbody::Leapfrog<double, glm::dvec3> leapfrog;
+        nbody::BlockLeapfrog<double, glm::dvec3> block(0, 0.02, 1.0);
+        for (int i = 0; i < step_count; ++i)
+        {
+            leapfrog.step(gravity, positions, velocities, weights, dt);
+            block.step(gravity, block_positions, block_velocities, weights, dt);
+        }
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            CHECK(glm::distance(positions[i], block_positions[i]) < 1e-12);
+        }
+    }
+
+    SECTION("BlockLeapfrog.step() must assign finer levels to bodies with greater accelerations"){
+        auto positions = initial_positions;
+        auto velocities = initial_velocities;
+        nbody::BlockLeapfrog<double, glm::dvec3> block(6, 0.02, 1.0);
+        block.step(gravity, positions, velocities, weights, dt);
+        CHECK(block.level(1) > block.level(2));
+    }
+
+    SECTION("BlockLeapfrog.step() must be more accurate than Leapfrog.step() for the same step size"){
+        auto positions = initial_positions;
+        auto velocities = initial_velocities;
+        auto block_positions = initial_positions;
+        auto block_velocities = initial_velocities;
+        nbody::Leapfrog<double, glm::dvec3> leapfrog;
+        nbody::BlockLeapfrog<double, glm::dvec3> block(6, 0.02, 1.0);
+        for (int i = 0; i < step_count; ++i)
+        {
+            leapfrog.step(gravity, positions, velocities, weights, dt);
+            block.step(gravity, block_positions, block_velocities, weights, dt);
+        }
+        CHECK(orbit_error(block_positions, 1, dt*step_count) < 0.05 * radii[1]);
+        CHECK(orbit_error(block_positions, 1, dt*step_count) < 0.1 * orbit_error(positions, 1, dt*step_count));
+        CHECK(orbit_error(block_positions, 2, dt*step_count) < 0.01 * radii[2]);
+    }
+
+    SECTION("BlockLeapfrog.step() must give the same result for fields that are only evaluated at active bodies"){
+        using Quadrupole = field::QuadrupoleVector<2, double, glm::dvec3>;
+        field::LinearBarnesHutMultipole<3, std::size_t, double, Quadrupole> tree(0.0, 1e-6);
+        auto positions = initial_positions;
+        auto velocities = initial_velocities;
+        auto block_positions = initial_positions;
+        auto block_velocities = initial_velocities;
+        nbody::BlockLeapfrog<double, glm::dvec3> naive_block(6, 0.02, 1.0);
+        nbody::BlockLeapfrog<double, glm::dvec3> tree_block(6, 0.02, 1.0);
+        for (int i = 0; i < step_count; ++i)
+        {
+            naive_block.step(gravity, positions, velocities, weights, dt);
+            tree_block.step(tree, block_positions, block_velocities, weights, dt);
+        }
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            CHECK(glm::distance(positions[i], block_positions[i]) < 1e-9);
+        }
+    }
+
+}
+
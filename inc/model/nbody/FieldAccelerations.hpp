@@ -0,0 +1,91 @@
+#pragma once
+
+// C libraries
+#include <cstddef>   // std::ptrdiff_t
+
+namespace nbody
+{
+
+	// `build_field` replaces the bodies of `field` with those of given `positions` and `weights`, using `build()` where the field offers it
+	template<typename Field, typename Positions, typename Weights>
+	void build_field(Field& field, const Positions& positions, const Weights& weights)
+	{
+		if constexpr (requires { field.build(positions, weights); })
+		{
+			field.build(positions, weights);
+		}
+		else
+		{
+			field.clear();
+			const std::ptrdiff_t count(positions.size());
+			for (std::ptrdiff_t i = 0; i < count; ++i)
+			{
+				field.add(positions[i], weights[i]);
+			}
+		}
+	}
+
+	/*
+	`field_accelerations` stores in `out[i]` the acceleration that acts on the i-th body,
+	where `field` is any of the multipole fields within `field::poles` whose monopoles are `MonopoleVector<2,…>` or `QuadrupoleVector<2,…>`,
+	and `weights` are gravitational parameters (G times mass), so that the value of the field is an acceleration.
+
+	Fields differ in what they offer, so the fastest of the following is used:
+	fields that offer `build()` are rebuilt from all bodies at once, and are otherwise rebuilt using `clear()` and `add()`,
+	fields that offer `self_values()` are evaluated at every body at once,
+	fields that offer a batched `operator()(positions, out)` are evaluated in a batch,
+	and all others are evaluated for each body, distributed across OpenMP threads.
+	*/
+	template<typename Field, typename Positions, typename Weights, typename Out>
+	void field_accelerations(Field& field, const Positions& positions, const Weights& weights, Out& out)
+	{
+		build_field(field, positions, weights);
+		if constexpr (requires { field.self_values(out); })
+		{
+			field.self_values(out);
+		}
+		else if constexpr (requires { field(positions, out); })
+		{
+			field(positions, out);
+		}
+		else
+		{
+			const std::ptrdiff_t count(positions.size());
+			#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 64)
+			#endif
+			for (std::ptrdiff_t i = 0; i < count; ++i)
+			{
+				out[i] = field(positions[i]);
+			}
+		}
+	}
+
+	/*
+	`field_accelerations(field, positions, weights, active, out)` is equivalent to the above
+	but only guarantees to update `out[i]` for the ids `i` that are listed in `active`.
+	The field is still built from all bodies, but is only evaluated at active bodies where the field permits,
+	so fields such as `FastMultipole` that only offer `self_values()` will update every element of `out`.
+	*/
+	template<typename Field, typename Positions, typename Weights, typename Active, typename Out>
+	void field_accelerations(Field& field, const Positions& positions, const Weights& weights, const Active& active, Out& out)
+	{
+		build_field(field, positions, weights);
+		if constexpr (requires { field(positions[0]); })
+		{
+			const std::ptrdiff_t count(active.size());
+			#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 64)
+			#endif
+			for (std::ptrdiff_t j = 0; j < count; ++j)
+			{
+				out[active[j]] = field(positions[active[j]]);
+			}
+		}
+		else
+		{
+			field.self_values(out);
+		}
+	}
+
+}
@@ -0,0 +1,86 @@
+
+// std libraries
+#include <cmath>    // std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include <field/poles/MonopoleVector.hpp>
+#include <field/poles/QuadrupoleVector.hpp>
+#include <field/poles/NaiveMultipole.hpp>
+#include <field/poles/DeepBarnesHutMultipole.hpp>
+#include <field/poles/LinearBarnesHutMultipole.hpp>
+#include <field/poles/FastMultipole.hpp>
+
+#include "FieldAccelerations.hpp"
+
+TEST_CASE( "field_accelerations()", "[nbody]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    using Quadrupole = field::QuadrupoleVector<2, double, glm::dvec3>;
+
+    std::vector<glm::dvec3> positions;
+    std::vector<double> weights;
+    for (int i = 0; i < 500; ++i)
+    {
+        positions.push_back(100.0 * glm::dvec3(std::sin(1.1*i), std::sin(2.3*i+0.5), std::sin(3.7*i+1.0)));
+        weights.push_back(1.0 + 10.0 * std::abs(std::sin(5.3*i)));
+    }
+    std::vector<std::size_t> active{0, 7, 100, 499};
+
+    field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1e-3);
+    std::vector<glm::dvec3> expected(positions.size());
+    nbody::field_accelerations(naive, positions, weights, expected);
+
+    auto relative_error = [&](const std::vector<glm::dvec3>& out, const std::vector<std::size_t>& ids){
+        double max_error(0.0);
+        for (std::size_t i : ids)
+        {
+            max_error = std::max(max_error, glm::length(out[i] - expected[i]) / glm::length(expected[i]));
+        }
+        return max_error;
+    };
+    std::vector<std::size_t> all(positions.size());
+    for (std::size_t i = 0; i < all.size(); ++i)
+    {
+        all[i] = i;
+    }
+
+    SECTION("field_accelerations() must find values at every body for fields that are built using clear() and add()"){
+        field::DeepBarnesHutMultipole<3, std::size_t, double, Monopole> deep(glm::dvec3(0), 256.0, 1.0);
+        std::vector<glm::dvec3> out(positions.size());
+        nbody::field_accelerations(deep, positions, weights, out);
+        for (std::size_t i : all)
+        {
+            CHECK(glm::length(out[i] - deep(positions[i])) < 1e-12);
+        }
+    }
+
+    SECTION("field_accelerations() must equal NaiveMultipole for fields that offer build() and operator() when θ=0"){
+        field::LinearBarnesHutMultipole<3, std::size_t, double, Quadrupole> linear(0.0, 1e-3);
+        std::vector<glm::dvec3> out(positions.size());
+        nbody::field_accelerations(linear, positions, weights, out);
+        CHECK(relative_error(out, all) < 1e-10);
+        std::vector<glm::dvec3> subset(positions.size(), glm::dvec3(0));
+        nbody::field_accelerations(linear, positions, weights, active, subset);
+        CHECK(relative_error(subset, active) < 1e-10);
+    }
+
+    SECTION("field_accelerations() must equal NaiveMultipole for fields that only offer self_values() when θ=0"){
+        field::FastMultipole<3, std::size_t, double, Quadrupole> fast(0.0, 1e-3);
+        std::vector<glm::dvec3> out(positions.size());
+        nbody::field_accelerations(fast, positions, weights, out);
+        CHECK(relative_error(out, all) < 1e-10);
+        std::vector<glm::dvec3> subset(positions.size(), glm::dvec3(0));
+        nbody::field_accelerations(fast, positions, weights, active, subset);
+        CHECK(relative_error(subset, active) < 1e-10);
+    }
+
+}
+
@@ -0,0 +1,44 @@
+#pragma once
+
+// C libraries
+#include <cstddef>   // std::ptrdiff_t
+
+namespace nbody
+{
+
+	/*
+	`kick` and `drift` are the two operators from which every integrator within `nbody` is composed.
+	Positions, velocities, and accelerations are each stored in their own contiguous array of vectors,
+	so both operators are a single pass over two arrays that is vectorized by the compiler,
+	and distributed across OpenMP threads when compiled with `-fopenmp`.
+	*/
+
+	// `kick` advances `velocities` by `dt` given the `accelerations` that act on each body
+	template<typename Velocities, typename Accelerations, typename scalar>
+	void kick(Velocities& velocities, const Accelerations& accelerations, const scalar dt)
+	{
+		const std::ptrdiff_t count(velocities.size());
+		#ifdef _OPENMP
+		#pragma omp parallel for simd
+		#endif
+		for (std::ptrdiff_t i = 0; i < count; ++i)
+		{
+			velocities[i] += accelerations[i] * dt;
+		}
+	}
+
+	// `drift` advances `positions` by `dt` given the `velocities` of each body
+	template<typename Positions, typename Velocities, typename scalar>
+	void drift(Positions& positions, const Velocities& velocities, const scalar dt)
+	{
+		const std::ptrdiff_t count(positions.size());
+		#ifdef _OPENMP
+		#pragma omp parallel for simd
+		#endif
+		for (std::ptrdiff_t i = 0; i < count; ++i)
+		{
+			positions[i] += velocities[i] * dt;
+		}
+	}
+
+}
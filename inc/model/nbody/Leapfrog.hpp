@@ -0,0 +1,64 @@
+#pragma once
+
+// std libraries
+#include <vector>    // std::vector
+
+// in-house libraries
+#include "KickDrift.hpp"
+#include "FieldAccelerations.hpp"
+
+namespace nbody
+{
+
+	/*
+	`Leapfrog` advances bodies under their mutual gravity using the kick-drift-kick form of the leapfrog (velocity Verlet) integrator:
+
+	    v ← v + a(x)·dt/2
+	    x ← x + v·dt
+	    v ← v + a(x)·dt/2
+
+	Leapfrog is second order and symplectic, so unlike the explicit Euler method,
+	energy oscillates about its initial value rather than drifting, and orbits do not spiral outward over time.
+	Accelerations at the end of one step are those at the start of the next,
+	so they are kept between calls to `step()`, and each step costs a single evaluation of the field.
+	`reset()` must be called if bodies are modified outside of `step()`.
+
+	`Field` is any of the multipole fields within `field::poles`, see `field_accelerations()`.
+	*/
+	template<typename scalar, typename vector>
+	class Leapfrog
+	{
+
+		std::vector<vector> accelerations;
+		bool is_current;
+
+	public:
+
+		Leapfrog():
+			accelerations(),
+			is_current(false)
+		{}
+
+		void reset()
+		{
+			is_current = false;
+		}
+
+		template<typename Field, typename Positions, typename Velocities, typename Weights>
+		void step(Field& field, Positions& positions, Velocities& velocities, const Weights& weights, const scalar dt)
+		{
+			if (!is_current || accelerations.size() != positions.size())
+			{
+				accelerations.resize(positions.size());
+				field_accelerations(field, positions, weights, accelerations);
+				is_current = true;
+			}
+			kick(velocities, accelerations, dt/scalar(2));
+			drift(positions, velocities, dt);
+			field_accelerations(field, positions, weights, accelerations);
+			kick(velocities, accelerations, dt/scalar(2));
+		}
+
+	};
+
+}
@@ -0,0 +1,127 @@
+
+// C libraries
+#include <cmath>    // std::sin, std::sqrt, std::pow
+
+// std libraries
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include <field/poles/MonopoleVector.hpp>
+#include <field/poles/QuadrupoleVector.hpp>
+#include <field/poles/NaiveMultipole.hpp>
+#include <field/poles/DeepBarnesHutMultipole.hpp>
+#include <field/poles/ShallowBarnesHutMultipole.hpp>
+#include <field/poles/LinearBarnesHutMultipole.hpp>
+#include <field/poles/FastMultipole.hpp>
+
+#include "Leapfrog.hpp"
+#include "Yoshida.hpp"
+#include "BlockLeapfrog.hpp"
+
+/*
+`Leapfrog_benchmark.cpp` reports the throughput of every combination of integrator and field within `nbody`,
+as the number of bodies that are advanced by one step per second of runtime.
+Bodies orbit a central body of much greater mass at radii that are spread logarithmically from 1 to 100,
+so that orbital periods span three orders of magnitude, as they do in a planetary system,
+and `BlockLeapfrog` assigns bodies to levels that span that range.
+A step of `Yoshida` evaluates the field three times, and a step of `BlockLeapfrog` evaluates it once per occupied substep,
+so throughput is only comparable for integrators of similar accuracy, which is also reported as the relative change in energy.
+`NaiveMultipole` and `DeepBarnesHutMultipole` are skipped for large body counts, where they would take minutes.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`.
+*/
+
+template<typename F>
+double seconds_for(const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    using Quadrupole = field::QuadrupoleVector<2, double, glm::dvec3>;
+    const std::size_t max_naive_count(10000);
+    const int step_count(4);
+    const double dt(0.5);
+    std::cout << "integrator\tfield\tcount\tbodies/s\tenergy error" << std::endl;
+    for (std::size_t count : {1000, 10000, 100000})
+    {
+        std::vector<glm::dvec3> initial_positions(count);
+        std::vector<glm::dvec3> initial_velocities(count);
+        std::vector<double> weights(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const double radius(std::pow(100.0, std::abs(std::sin(5.3*i))));
+            const double angle(7.1*i);
+            const double height(0.01 * radius * std::sin(3.7*i));
+            initial_positions[i] = glm::dvec3(radius*std::cos(angle), radius*std::sin(angle), height);
+            initial_velocities[i] = std::sqrt(1.0/radius) * glm::dvec3(-std::sin(angle), std::cos(angle), 0.0);
+            weights[i] = 1e-6 / double(count);
+        }
+        initial_positions[0] = glm::dvec3(0);
+        initial_velocities[0] = glm::dvec3(0);
+        weights[0] = 1.0;
+
+        auto energy = [&](const std::vector<glm::dvec3>& positions, const std::vector<glm::dvec3>& velocities){
+            // only the potential of the central body is considered, since the remainder is negligible
+            double result(0.0);
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                result += weights[i] * (0.5*glm::dot(velocities[i], velocities[i]) - weights[0]/glm::distance(positions[i], positions[0]));
+            }
+            return result;
+        };
+        const double initial_energy(energy(initial_positions, initial_velocities));
+
+        auto run = [&](const std::string& integrator_name, auto& integrator, const std::string& field_name, auto& field){
+            auto positions = initial_positions;
+            auto velocities = initial_velocities;
+            const double seconds = seconds_for([&](){
+                for (int i = 0; i < step_count; ++i)
+                {
+                    integrator.step(field, positions, velocities, weights, dt);
+                }
+            });
+            std::cout << integrator_name << "\t" << field_name << "\t" << count << "\t"
+                << double(count*step_count)/seconds << "\t"
+                << std::abs(energy(positions, velocities)/initial_energy - 1.0) << std::endl;
+        };
+
+        auto run_integrators = [&](const std::string& field_name, auto& field){
+            nbody::Leapfrog<double, glm::dvec3> leapfrog;
+            nbody::Yoshida<double, glm::dvec3> yoshida;
+            nbody::BlockLeapfrog<double, glm::dvec3> block(6, 0.02, 1.0);
+            run("leapfrog", leapfrog, field_name, field);
+            run("yoshida", yoshida, field_name, field);
+            run("block", block, field_name, field);
+        };
+
+        if (count <= max_naive_count)
+        {
+            field::NaiveMultipole<double, glm::dvec3, Monopole> naive(1e-3);
+            run_integrators("naive", naive);
+            field::DeepBarnesHutMultipole<3, std::size_t, double, Monopole> deep(glm::dvec3(0), 256.0, 1.0);
+            run_integrators("deep", deep);
+        }
+
+        field::ShallowBarnesHutMultipole<3, std::size_t, double, Monopole> shallow(glm::dvec3(0), 256.0, 4.0);
+        run_integrators("shallow", shallow);
+
+        field::LinearBarnesHutMultipole<3, std::size_t, double, Quadrupole> linear(0.5, 1e-3);
+        run_integrators("linear quadrupole θ=0.5", linear);
+
+        field::FastMultipole<3, std::size_t, double, Quadrupole> fast(0.3, 1e-3);
+        run_integrators("fast quadrupole θ=0.3", fast);
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+
+// std libraries
+#include <cmath>    // std::cos, std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/vec3.hpp>
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include <field/poles/MonopoleVector.hpp>
+#include <field/poles/NaiveMultipole.hpp>
+
+#include "KickDrift.hpp"
+#include "FieldAccelerations.hpp"
+#include "Leapfrog.hpp"
+#include "Yoshida.hpp"
+
+/*
+Bodies are given in units where G=1, so weights are both masses and gravitational parameters.
+The energy of a system is Σ½mᵢvᵢ² - Σᵢ<ⱼ mᵢmⱼ/rᵢⱼ.
+*/
+double orbital_energy(const std::vector<glm::dvec3>& positions, const std::vector<glm::dvec3>& velocities, const std::vector<double>& weights)
+{
+    double energy(0.0);
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        energy += 0.5 * weights[i] * glm::dot(velocities[i], velocities[i]);
+        for (std::size_t j = i+1; j < positions.size(); ++j)
+        {
+            energy -= weights[i] * weights[j] / glm::distance(positions[i], positions[j]);
+        }
+    }
+    return energy;
+}
+
+TEST_CASE( "Leapfrog.step()", "[nbody]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    field::NaiveMultipole<double, glm::dvec3, Monopole> gravity(1e-6);
+
+    // an eccentric binary whose center of mass is at rest
+    const std::vector<double> weights{1.0, 0.5};
+    const std::vector<glm::dvec3> initial_positions{glm::dvec3(-1.0/3.0, 0, 0), glm::dvec3(2.0/3.0, 0, 0)};
+    const std::vector<glm::dvec3> initial_velocities{glm::dvec3(0, -0.4, 0), glm::dvec3(0, 0.8, 0)};
+    const double initial_energy(orbital_energy(initial_positions, initial_velocities, weights));
+    const double dt(0.01);
+    const int step_count(3000);
+
+    SECTION("Leapfrog.step() must conserve energy better than the explicit Euler method"){
+        auto positions = initial_positions;
+        auto velocities = initial_velocities;
+        nbody::Leapfrog<double, glm::dvec3> leapfrog;
+        for (int i = 0; i < step_count; ++i)
+        {
+            leapfrog.step(gravity, positions, velocities, weights, dt);
+        }
+        const double leapfrog_error(std::abs(orbital_energy(positions, velocities, weights) / initial_energy - 1.0));
+
+        positions = initial_positions;
+        velocities = initial_velocities;
+        std::vector<glm::dvec3> accelerations(positions.size());
+        for (int i = 0; i < step_count; ++i)
+        {
+            nbody::field_accelerations(gravity, positions, weights, accelerations);
+            nbody::kick(velocities, accelerations, dt);
+            nbody::drift(positions, velocities, dt);
+        }
+        const double euler_error(std::abs(orbital_energy(positions, velocities, weights) / initial_energy - 1.0));
+
+        CHECK(leapfrog_error < 1e-3);
+        CHECK(leapfrog_error < 0.01 * euler_error);
+    }
+
+    SECTION("Leapfrog.step() must be time reversible"){
+        auto positions = initial_positions;
+        auto velocities = initial_velocities;
+        nbody::Leapfrog<double, glm::dvec3> leapfrog;
+        for (int i = 0; i < step_count; ++i)
+        {
+            leapfrog.step(gravity, positions, velocities, weights, dt);
+        }
+        for (int i = 0; i < step_count; ++i)
+        {
+            leapfrog.step(gravity, positions, velocities, weights, -dt);
+        }
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            CHECK(glm::distance(positions[i], initial_positions[i]) < 1e-8);
+            CHECK(glm::distance(velocities[i], initial_velocities[i]) < 1e-8);
+        }
+    }
+
+}
+
+TEST_CASE( "Yoshida.step()", "[nbody]" ) {
+
+    using Monopole = field::MonopoleVector<2, double, glm::dvec3>;
+    field::NaiveMultipole<double, glm::dvec3, Monopole> gravity(1e-6);
+
+    // a massless body in a circular orbit of unit radius and period 2π about a body of unit mass
+    const std::vector<double> weights{1.0, 0.0};
+    const double pi(3.141592653589793238462643383279502884);
+
+    auto orbit_error = [&](auto& integrator, const int step_count){
+        std::vector<glm::dvec3> positions{glm::dvec3(0), glm::dvec3(1,0,0)};
+        std::vector<glm::dvec3> velocities{glm::dvec3(0), glm::dvec3(0,1,0)};
+        for (int i = 0; i < step_count; ++i)
+        {
+            integrator.step(gravity, positions, velocities, weights, 2.0*pi/step_count);
+        }
+        return glm::distance(positions[1], glm::dvec3(1,0,0));
+    };
+
+    SECTION("Yoshida.step() must be more accurate than Leapfrog.step() for the same step size"){
+        nbody::Leapfrog<double, glm::dvec3> leapfrog;
+        nbody::Yoshida<double, glm::dvec3> yoshida;
+        CHECK(orbit_error(yoshida, 64) < 0.1 * orbit_error(leapfrog, 64));
+    }
+
+    SECTION("Yoshida.step() must be 4th order, where halving the step size reduces error by roughly 16"){
+        nbody::Yoshida<double, glm::dvec3> coarse;
+        nbody::Yoshida<double, glm::dvec3> fine;
+        const double ratio(orbit_error(coarse, 64) / orbit_error(fine, 128));
+        CHECK(ratio > 12.0);
+        CHECK(ratio < 20.0);
+    }
+
+}
+
@@ -0,0 +1,54 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::cbrt
+
+// in-house libraries
+#include "Leapfrog.hpp"
+
+namespace nbody
+{
+
+	/*
+	`Yoshida` advances bodies using the 4th order symplectic integrator of Yoshida (1990),
+	which composes three leapfrog steps of durations w₁dt, w₀dt, and w₁dt, where:
+
+	    w₁ = 1/(2-∛2)
+	    w₀ = -∛2/(2-∛2)
+
+	The middle step runs backwards in time, and the odd order errors of the three steps cancel.
+	Each step costs three evaluations of the field, but error falls with dt⁴ rather than dt²,
+	so for a given accuracy, `Yoshida` permits much larger steps than `Leapfrog`.
+	`reset()` must be called if bodies are modified outside of `step()`.
+	*/
+	template<typename scalar, typename vector>
+	class Yoshida
+	{
+
+		Leapfrog<scalar,vector> leapfrog;
+
+	public:
+
+		Yoshida():
+			leapfrog()
+		{}
+
+		void reset()
+		{
+			leapfrog.reset();
+		}
+
+		template<typename Field, typename Positions, typename Velocities, typename Weights>
+		void step(Field& field, Positions& positions, Velocities& velocities, const Weights& weights, const scalar dt)
+		{
+			const scalar cbrt2(std::cbrt(scalar(2)));
+			const scalar w1(scalar(1)/(scalar(2)-cbrt2));
+			const scalar w0(-cbrt2/(scalar(2)-cbrt2));
+			leapfrog.step(field, positions, velocities, weights, w1*dt);
+			leapfrog.step(field, positions, velocities, weights, w0*dt);
+			leapfrog.step(field, positions, velocities, weights, w1*dt);
+		}
+
+	};
+
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::floor
+#include <cstddef>   // std::size_t
+
+// std libraries
+#include <algorithm> // std::min, std::max, std::max_element
+#include <vector>    // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>      // *vec3
+#include <glm/geometric.hpp> // length, distance
+
+#include <math/special.hpp>  // math::floormod
+
+#include "Universals.hpp"
+#include "UniversalPropagator.hpp"
+
+namespace orbit {
+
+	/*
+	`PeriodicSamples` is a cache of positions for periodic orbits,
+	so that positions can be found by interpolation rather than by solving Kepler's equation with `UniversalPropagator`.
+	This is useful for scenes with thousands of small moons whose orbits do not change between frames.
+
+	Each orbit is sampled at evenly spaced times across a single period,
+	where both position and velocity are stored for each sample,
+	and positions between samples are found by cubic Hermite interpolation.
+	The error of cubic Hermite interpolation is proportional to s²(1-s)², where s is the fraction of the way between samples,
+	so it is greatest near the midpoint between samples, and is O(h⁴) for a sample interval h.
+	`build()` therefore estimates the error of each orbit as the greatest distance between interpolated and solved positions at midpoints,
+	relative to the greatest distance of the orbit from its origin,
+	and doubles the samples of any orbit whose error exceeds `tolerance`, until `max_sample_count` is reached,
+	in which case the error of the orbit is left above `tolerance`, as reported by `error()` and the return value of `build()`.
+	Midpoints become samples once an orbit is refined, so each round of refinement only needs to solve for new midpoints,
+	and all midpoints of a round are solved in a single batch by `UniversalPropagator::states()`.
+
+	Samples are stored contiguously for all orbits, where `offsets[i]` is the first sample of the i-th orbit.
+	*/
+	template <typename scalar>
+	class PeriodicSamples {
+		using vec3 = glm::vec<3,scalar,glm::defaultp>;
+
+		std::vector<scalar> periods;
+		std::vector<scalar> errors;
+		std::vector<std::size_t> offsets;
+		std::vector<vec3> positions;
+		std::vector<vec3> velocities;
+
+		// `interpolate` returns the cubic Hermite interpolation between two samples that are separated by an interval `h`
+		static inline vec3 interpolate(
+			const vec3& p0, const vec3& v0,
+			const vec3& p1, const vec3& v1,
+			const scalar h, const scalar s
+		) noexcept {
+			const scalar s2(s*s);
+			const scalar s3(s2*s);
+			return (scalar(2)*s3 - scalar(3)*s2 + scalar(1)) * p0
+			     + (s3 - scalar(2)*s2 + s) * h * v0
+			     + (scalar(3)*s2 - scalar(2)*s3) * p1
+			     + (s3 - s2) * h * v1;
+		}
+
+	public:
+
+		const scalar tolerance;
+		const std::size_t initial_sample_count;
+		const std::size_t max_sample_count;
+
+		PeriodicSamples(
+			const scalar tolerance,
+			const std::size_t initial_sample_count = 16,
+			const std::size_t max_sample_count = 4096
+		):
+			tolerance(tolerance),
+			initial_sample_count(std::max(std::size_t(2), initial_sample_count)),
+			max_sample_count(std::max(std::size_t(2), max_sample_count))
+		{}
+
+		// the number of orbits that were given to `build()`
+		inline std::size_t size() const noexcept {
+			return periods.size();
+		}
+
+		inline std::size_t sample_count(const std::size_t i) const noexcept {
+			return offsets[i+1] - offsets[i];
+		}
+
+		// the estimated error of the i-th orbit, relative to the greatest distance of the orbit from its origin
+		inline scalar error(const std::size_t i) const noexcept {
+			return errors[i];
+		}
+
+		/*
+		`build` replaces the samples of the cache with those of the given `orbits`,
+		where `periods[i]` is the period of `orbits[i]`,
+		and returns the greatest estimated error among orbits, 
+		which exceeds `tolerance` if any orbit reached `max_sample_count` before reaching `tolerance`
+		*/
+		template<typename Orbits, typename Periods>
+		scalar build(const UniversalPropagator<scalar>& propagator, const Orbits& orbits, const Periods& periods_) {
+			const std::size_t count(orbits.size());
+			periods.assign(periods_.begin(), periods_.end());
+			errors.assign(count, scalar(0));
+			std::vector<std::size_t> counts(count, initial_sample_count);
+			std::vector<std::vector<vec3>> orbit_positions(count);
+			std::vector<std::vector<vec3>> orbit_velocities(count);
+
+			std::vector<std::size_t> pending(count);
+			for (std::size_t i = 0; i < count; ++i) {
+				pending[i] = i;
+			}
+			std::vector<Universals<scalar>> batch_orbits;
+			std::vector<scalar> batch_times;
+			std::vector<vec3> batch_positions;
+			std::vector<vec3> batch_velocities;
+			while (!pending.empty()) {
+				// for each pending orbit, samples are followed by midpoints, 
+				// where samples are only needed on the first round, since midpoints become samples once refined
+				batch_orbits.clear();
+				batch_times.clear();
+				for (std::size_t i : pending) {
+					const scalar h(periods[i] / scalar(counts[i]));
+					if (orbit_positions[i].size() != counts[i]) {
+						for (std::size_t k = 0; k < counts[i]; ++k) {
+							batch_orbits.push_back(orbits[i]);
+							// the first sample is found at t=P rather than t=0, since `state()` returns the initial state at t=0 regardless of `time_offset`
+							batch_times.push_back(k == 0? periods[i] : h*scalar(k));
+						}
+					}
+					for (std::size_t k = 0; k < counts[i]; ++k) {
+						batch_orbits.push_back(orbits[i]);
+						batch_times.push_back(h*(scalar(k)+scalar(0.5)));
+					}
+				}
+				batch_positions.resize(batch_orbits.size());
+				batch_velocities.resize(batch_orbits.size());
+				propagator.states(batch_orbits, batch_times, batch_positions, batch_velocities);
+
+				std::vector<std::size_t> unresolved;
+				std::size_t offset(0);
+				for (std::size_t i : pending) {
+					const std::size_t n(counts[i]);
+					const scalar h(periods[i] / scalar(n));
+					auto& P = orbit_positions[i];
+					auto& V = orbit_velocities[i];
+					if (P.size() != n) {
+						P.assign(batch_positions.begin()+offset, batch_positions.begin()+offset+n);
+						V.assign(batch_velocities.begin()+offset, batch_velocities.begin()+offset+n);
+						offset += n;
+					}
+					scalar radius(0);
+					for (std::size_t k = 0; k < n; ++k) {
+						radius = std::max(radius, glm::length(P[k]));
+					}
+					scalar max_error(0);
+					for (std::size_t k = 0; k < n; ++k) {
+						const std::size_t k1((k+1)%n);
+						const vec3 estimate(interpolate(P[k], V[k], P[k1], V[k1], h, scalar(0.5)));
+						max_error = std::max(max_error, glm::distance(estimate, batch_positions[offset+k]));
+					}
+					errors[i] = radius > scalar(0)? max_error / radius : max_error;
+					if (errors[i] > tolerance && 2*n <= max_sample_count) {
+						// interleave samples with midpoints
+						std::vector<vec3> refined_positions(2*n);
+						std::vector<vec3> refined_velocities(2*n);
+						for (std::size_t k = 0; k < n; ++k) {
+							refined_positions[2*k] = P[k];
+							refined_velocities[2*k] = V[k];
+							refined_positions[2*k+1] = batch_positions[offset+k];
+							refined_velocities[2*k+1] = batch_velocities[offset+k];
+						}
+						P.swap(refined_positions);
+						V.swap(refined_velocities);
+						counts[i] = 2*n;
+						unresolved.push_back(i);
+					}
+					offset += n;
+				}
+				pending.swap(unresolved);
+			}
+
+			offsets.assign(count+1, 0);
+			for (std::size_t i = 0; i < count; ++i) {
+				offsets[i+1] = offsets[i] + counts[i];
+			}
+			positions.resize(offsets[count]);
+			velocities.resize(offsets[count]);
+			for (std::size_t i = 0; i < count; ++i) {
+				std::copy(orbit_positions[i].begin(), orbit_positions[i].end(), positions.begin()+offsets[i]);
+				std::copy(orbit_velocities[i].begin(), orbit_velocities[i].end(), velocities.begin()+offsets[i]);
+			}
+			return count > 0? *std::max_element(errors.begin(), errors.end()) : scalar(0);
+		}
+
+		/*
+		`position` returns the interpolated position of the i-th orbit at time `t`,
+		which approximates `UniversalPropagator::state(orbits[i], t).position`
+		*/
+		vec3 position(const std::size_t i, const scalar t) const noexcept {
+			const std::size_t n(sample_count(i));
+			const scalar h(periods[i] / scalar(n));
+			const scalar x(math::floormod(t, periods[i]) / h);
+			const std::size_t k(std::min(std::size_t(std::floor(x)), n-1));
+			const std::size_t k1((k+1)%n);
+			const std::size_t offset(offsets[i]);
+			return interpolate(
+				positions[offset+k], velocities[offset+k],
+				positions[offset+k1], velocities[offset+k1],
+				h, x - scalar(k));
+		}
+
+	};
+
+}
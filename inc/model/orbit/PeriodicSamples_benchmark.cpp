@@ -0,0 +1,85 @@
+
+// C libraries
+#include <cmath>    // std::sin, std::sqrt
+
+// std libraries
+#include <algorithm> // std::max
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "Universals.hpp"
+#include "UniversalPropagator.hpp"
+#include "PeriodicSamples.hpp"
+
+/*
+`PeriodicSamples_benchmark.cpp` reports the runtime of finding positions for a population of small moons at a single time,
+either by solving each orbit using `UniversalPropagator::positions()`, or by interpolating `PeriodicSamples`,
+along with the time needed to build the samples, the mean sample count per orbit, and the largest error of interpolation,
+relative to the greatest distance of each orbit from its origin.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`.
+*/
+
+template<typename F>
+double seconds_for(const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    using vec3 = glm::dvec3;
+    using Universals = orbit::Universals<double>;
+
+    constexpr double pi = 3.141592653589793238462;
+    const orbit::UniversalPropagator<double> propagator(1.0);
+    const std::size_t count(10000);
+    const double time(123.456);
+
+    std::vector<Universals> orbits;
+    std::vector<double> periods;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const double r0(1.0 + 9.0*std::abs(std::sin(1.3*i)));
+        const double eccentricity(0.5*std::abs(std::sin(2.9*i)));
+        const double semi_major_axis(r0 / (1.0 - eccentricity));
+        orbits.emplace_back(1.0, vec3(r0, 0.0, 0.0), vec3(0.0, std::sqrt((1.0 + eccentricity)/r0), 0.0));
+        periods.push_back(2.0 * pi * std::sqrt(semi_major_axis*semi_major_axis*semi_major_axis));
+    }
+    const std::vector<double> times(count, time);
+    std::vector<vec3> solved(count);
+    std::vector<vec3> interpolated(count);
+    const double solve_seconds = seconds_for([&](){ propagator.positions(orbits, times, solved); });
+
+    std::cout << "tolerance\tcount\tsolve\tbuild\tinterpolate\tsamples/orbit\terror" << std::endl;
+    for (double tolerance : {1e-4, 1e-6, 1e-8})
+    {
+        orbit::PeriodicSamples<double> samples(tolerance);
+        const double build_seconds = seconds_for([&](){ samples.build(propagator, orbits, periods); });
+        const double interpolate_seconds = seconds_for([&](){
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                interpolated[i] = samples.position(i, time);
+            }
+        });
+        double error(0.0);
+        double sample_count(0.0);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const double apoapsis(glm::length(propagator.state(orbits[i], periods[i]/2.0).position));
+            error = std::max(error, glm::distance(solved[i], interpolated[i]) / apoapsis);
+            sample_count += double(samples.sample_count(i)) / double(count);
+        }
+        std::cout << tolerance << "\t" << count << "\t" << solve_seconds << "\t" << build_seconds << "\t"
+            << interpolate_seconds << "\t" << sample_count << "\t" << error << std::endl;
+    }
+    return 0;
+}
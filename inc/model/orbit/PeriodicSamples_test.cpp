@@ -0,0 +1,79 @@
+
+// std libraries
+#include <cmath>    // std::sqrt, std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch/catch.hpp>
+
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/geometric.hpp>// glm::distance
+
+// in-house libraries
+#include "Universals.hpp"
+#include "UniversalPropagator.hpp"
+#include "PeriodicSamples.hpp"
+
+TEST_CASE("PeriodicSamples::position()", "[body]") {
+
+	using vec3 = glm::vec<3,double,glm::defaultp>;
+	using Universals = orbit::Universals<double>;
+	using Propagator = orbit::UniversalPropagator<double>;
+
+	constexpr double pi = 3.141592653589793238462;
+
+	// orbits are given in units where G=1, about a body of unit mass, starting at periapsis with eccentricities from 0 to 0.9
+	const Propagator propagator(1.0);
+	std::vector<Universals> orbits;
+	std::vector<double> periods;
+	for (const double eccentricity : {0.0, 0.1, 0.5, 0.9})
+	{
+		const double r0(1.0);
+		const double v0(std::sqrt((1.0 + eccentricity)/r0));
+		const double semi_major_axis(r0 / (1.0 - eccentricity));
+		orbits.emplace_back(1.0, vec3(r0, 0.0, 0.0), vec3(0.0, v0, 0.0));
+		periods.push_back(2.0 * pi * std::sqrt(semi_major_axis*semi_major_axis*semi_major_axis));
+	}
+
+	const double tolerance(1e-6);
+	orbit::PeriodicSamples<double> samples(tolerance);
+	const double max_error(samples.build(propagator, orbits, periods));
+
+	SECTION("PeriodicSamples.build() must refine samples until estimated errors are within tolerance") {
+		for (std::size_t i = 0; i < orbits.size(); ++i)
+		{
+			CHECK(samples.error(i) <= tolerance);
+		}
+		CHECK(max_error <= tolerance);
+	}
+
+	SECTION("PeriodicSamples.build() must report an error above tolerance if max_sample_count is reached first") {
+		orbit::PeriodicSamples<double> capped(tolerance, 16, 32);
+		const double capped_error(capped.build(propagator, orbits, periods));
+		CHECK(capped.sample_count(3) == 32);
+		CHECK(capped_error > tolerance);
+		CHECK(capped_error == capped.error(3));
+	}
+
+	SECTION("PeriodicSamples.build() must assign more samples to more eccentric orbits") {
+		CHECK(samples.sample_count(0) <= samples.sample_count(2));
+		CHECK(samples.sample_count(2) < samples.sample_count(3));
+	}
+
+	SECTION("PeriodicSamples.position() must approximate UniversalPropagator.state() to within a small multiple of tolerance") {
+		for (std::size_t i = 0; i < orbits.size(); ++i)
+		{
+			const double apoapsis(glm::length(propagator.state(orbits[i], periods[i]/2.0).position));
+			for (int j = 0; j < 100; ++j)
+			{
+				// times span several periods and both signs
+				const double t(periods[i] * 3.0 * std::sin(1.7*j));
+				const vec3 expected(propagator.state(orbits[i], t).position);
+				CHECK(glm::distance(samples.position(i, t), expected) / apoapsis < 2.0 * tolerance);
+			}
+		}
+	}
+
+}
+
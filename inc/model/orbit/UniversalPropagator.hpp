@@ -2,6 +2,7 @@
 
 // C libraries
 #include <cmath>
+#include <cstddef>   // std::size_t, std::ptrdiff_t
 
 // 3rd party libraries
 #include <glm/vec3.hpp>      // *vec3
@@ -27,84 +28,111 @@ namespace orbit {
 		static constexpr scalar s3 = scalar(3);
 		static constexpr scalar pi = scalar(3.141592653589793238462643383279502884L);
 
-		scalar C(const scalar y) const noexcept
-		{
-			scalar Ay = std::abs(y);
-			scalar SAy = std::sqrt(Ay);
-			return (y >= s0? (s1 - cos(SAy)) 
-			              : (cosh(SAy) - s1)) / Ay;
-		}
+		// |ψ| below which Stumpff functions are found by their series expansion, where the closed form suffers from cancellation
+		static constexpr scalar stumpff_series_threshold = scalar(0.1);
 
-		scalar S(const scalar y) const noexcept
-		{
-			scalar SAy = std::sqrt(std::abs(y));
-			scalar SAy3 = SAy*SAy*SAy;
-			return (y >= s0? (SAy - sin(SAy))
-	                      : (sinh(SAy) - SAy)) / SAy3;
-		}
+		/*
+		`stumpff` finds both of the Stumpff functions C(ψ) and S(ψ) from a single evaluation of cos/sin or cosh/sinh:
 
-		scalar dCax2dx(const scalar a, const scalar x) const noexcept
+		    C(ψ) = (1-cos√ψ)/ψ      S(ψ) = (√ψ-sin√ψ)/√ψ³      for ψ>0
+		    C(ψ) = (cosh√-ψ-1)/-ψ   S(ψ) = (sinh√-ψ-√-ψ)/√-ψ³  for ψ<0
+
+		Near ψ=0, both are found from their Maclaurin series, which converge to machine precision within 6 terms for |ψ|<0.1.
+		*/
+		static inline void stumpff(const scalar psi, scalar& C, scalar& S) noexcept
 		{
-			const scalar Ax = std::abs(x);
-			const scalar Aa = std::abs(a);
-			const scalar SAa = std::sqrt(Aa);
-			const scalar sx = math::sign(x);
-	        const scalar x2  = x*x;
-	        const scalar x3  = x*x2;
-	        const scalar ax2  = a * x2;
-			return (ax2 >= s0? 
-			     std::sin(SAa*Ax)*sx/(x2*SAa) - s2*(s1  - std::cos(SAa*Ax))/(x3*Aa)
-			  : std::sinh(SAa*Ax)*sx/(x2*SAa) - s2*(-s1 + std::cosh(SAa*Ax))/(x3*Aa)
-			);
+			if (std::abs(psi) < stumpff_series_threshold)
+			{
+				C = s1/scalar(2)    + psi*(-s1/scalar(24)  + psi*(s1/scalar(720)  + psi*(-s1/scalar(40320)  + psi*(s1/scalar(3628800)  - psi*s1/scalar(479001600)))));
+				S = s1/scalar(6)    + psi*(-s1/scalar(120) + psi*(s1/scalar(5040) + psi*(-s1/scalar(362880) + psi*(s1/scalar(39916800) - psi*s1/scalar(6227020800)))));
+			}
+			else if (psi > s0)
+			{
+				const scalar root(std::sqrt(psi));
+				C = (s1 - std::cos(root)) / psi;
+				S = (root - std::sin(root)) / (root*psi);
+			}
+			else
+			{
+				const scalar root(std::sqrt(-psi));
+				C = (std::cosh(root) - s1) / -psi;
+				S = (std::sinh(root) - root) / (-root*psi);
+			}
 		}
 
-		scalar dSax2dx(const scalar a, const scalar x) const noexcept
-		{
-			const scalar Ax = std::abs(x);
-			const scalar Aa = std::abs(a);
-			const scalar SAa = std::sqrt(Aa);
-			const scalar SAa3 = SAa*SAa*SAa;
-			const scalar sx = math::sign(x);
-	        const scalar x2  = x*x;
-	        const scalar x3  = x*x2;
-	        const scalar x4  = x*x3;
-	        const scalar x5  = x*x4;
-	        const scalar ax2  = a * x2;
-			return (ax2 >= s0? 
-			    ((-std::cos(SAa*Ax)*SAa*sx + SAa*sx)*Ax/(x4*SAa3) + (-std::sin(SAa*Ax) + SAa*Ax)*sx/(x4*SAa3) - 4*(-std::sin(SAa*Ax) + SAa*Ax)*Ax/(x5*SAa3))
-			  : ((std::cosh(SAa*Ax)*SAa*sx - SAa*sx)*Ax/(x4*SAa3) + (std::sinh(SAa*Ax) - SAa*Ax)*sx/(x4*SAa3) - 4*(std::sinh(SAa*Ax) - SAa*Ax)*Ax/(x5*SAa3))
-			);
+		// `setup` finds the parameters of Kepler's equation in universal variables for an orbit at time `t`, and an initial estimate for its root
+		void setup(
+			const Universals& orbit, 
+			const scalar t, 
+			scalar& x0, 
+			scalar& a, 
+			scalar& r0, 
+			scalar& sigma0, 
+			scalar& dtsqrtmu, 
+			scalar& dt
+		) const noexcept {
+	        const scalar t0 = orbit.time_offset;
+	        const vec3  R0  = orbit.initial_position;
+	        const vec3  V0  = orbit.initial_velocity;
+	        const scalar mu = gravitational_constant * orbit.combined_mass;
+	        const scalar sqrt_mu = std::sqrt(mu);
+	        r0 = glm::length(R0);
+	        const scalar v0 = glm::length(V0);
+	        a  = s2 / r0 - (v0 * v0) / mu; // alpha, the inverse semi-major axis
+	        const scalar sma  = s1/a; // semi-major axis
+	        const scalar p = s2*pi*std::sqrt(sma*sma*sma/mu); // period
+	        dt = (a > s0 && force_congruence? math::floormod(t,p):t) - t0;
+	        x0 = a >= s0? 
+	        		  dt*sqrt_mu*a // elliptic or parabolic
+	        		: math::sign(dt) * std::sqrt(-sma) *
+		                 std::log(
+		                     -s2 * dt * mu /
+		                     (sma*(glm::dot(R0, V0) +
+		                       math::sign(dt) * std::sqrt(-mu*sma) * (s1 - r0 * a)))
+		                 ); // hyperbolic
+	        sigma0 = glm::dot(R0, V0) / sqrt_mu;
+	        dtsqrtmu = dt * sqrt_mu;
 		}
 
-		scalar d2Cax2dx2(const scalar a, const scalar x) const noexcept
-		{
-			const scalar Ax = std::abs(x);
-			const scalar Aa = std::abs(a);
-			const scalar SAa = std::sqrt(Aa);
-			const scalar sx = math::sign(x);
-	        const scalar x2  = x*x;
+		// `state_for_solution` finds the position `R` and velocity `V` of an orbit given a root `x` of Kepler's equation in universal variables
+		void state_for_solution(
+			const Universals& orbit, 
+			const scalar x, 
+			const scalar a, 
+			const scalar r0, 
+			const scalar dt, 
+			vec3& R, 
+			vec3& V
+		) const noexcept {
+	        const vec3  R0  = orbit.initial_position;
+	        const vec3  V0  = orbit.initial_velocity;
+	        const scalar sqrt_mu = std::sqrt(gravitational_constant * orbit.combined_mass);
+	        const scalar x2   = x * x;
+	        const scalar x3   = x * x2;
 	        const scalar ax2  = a * x2;
-			return (ax2 >= s0? 
-		        (std::cos(SAa*Ax)*sx*sx  - 4*std::sin(SAa*Ax)*sx/(x*SAa)  + 6*(s1 - std::cos (SAa*Ax))/(x2*Aa))/x2
-   			  : (std::cosh(SAa*Ax)*sx*sx - 4*std::sinh(SAa*Ax)*sx/(x*SAa) - 6*(s1 - std::cosh(SAa*Ax))/(x2*Aa))/x2 
-			);
+	        scalar Cax2, Sax2;
+	        stumpff(ax2, Cax2, Sax2);
+	        R = (s1 - x2 / r0 * Cax2) * R0 +
+	            (dt - x3 / sqrt_mu * Sax2) * V0;
+	        const scalar r = glm::length(R);
+	        V = (x * sqrt_mu / (r * r0) * (ax2 * Sax2 - s1)) * R0 +
+	            (s1 - x2 / r * Cax2) * V0;
 		}
 
-		scalar d2Sax2dx2(const scalar a, const scalar x) const noexcept
-		{
-			const scalar Ax = std::abs(x);
-			const scalar Aa = std::abs(a);
-			const scalar SAa = std::sqrt(Aa);
-			const scalar SAa3 = SAa*SAa*SAa;
-			const scalar sx = math::sign(x);
-	        const scalar x2  = x*x;
-	        const scalar x3  = x*x2;
-	        const scalar x4  = x*x3;
-	        const scalar ax2  = a * x2;
-			return (ax2 >= s0? 
-			      (- 2*(std::cos(SAa*Ax)  - 1)*sx*sx/Aa + (std::sin(SAa*Ax)*Aa*sx*sx )*Ax/SAa3 + 8*(std::sin(SAa*Ax)  - SAa*Ax)*sx/(x*SAa3) + 8*(std::cos(SAa*Ax)  - 1)*Ax*sx/(x*Aa) - 20*(std::sin(SAa*Ax)  - SAa*Ax)*Ax/(x2*SAa3))/x4
-			    : (+ 2*(std::cosh(SAa*Ax) - 1)*sx*sx/Aa + (std::sinh(SAa*Ax)*Aa*sx*sx)*Ax/SAa3 - 8*(std::sinh(SAa*Ax) - SAa*Ax)*sx/(x*SAa3) - 8*(std::cosh(SAa*Ax) - 1)*Ax*sx/(x*Aa) + 20*(std::sinh(SAa*Ax) - SAa*Ax)*Ax/(x2*SAa3))/x4
-			);
+		/*
+		`propagate` calls `store(i, R, V)` with the position and velocity of `orbits[i]` at time `times[i]`, 
+		see `positions()` for a description of the method
+		*/
+		template<typename Orbits, typename Times, typename Store>
+		void propagate(const Orbits& orbits, const Times& times, const Store& store) const {
+			const std::ptrdiff_t count(orbits.size());
+			#ifdef _OPENMP
+			#pragma omp parallel for schedule(dynamic, 64)
+			#endif
+			for (std::ptrdiff_t i = 0; i < count; ++i) {
+				const State state_(state(orbits[i], times[i]));
+				store(i, state_.position, state_.velocity);
+			}
 		}
 
 	public:
@@ -129,6 +157,15 @@ namespace orbit {
 	    {
 	    }
 
+	    /*
+	    `refine` returns the step of Laguerre's method towards the root of Kepler's equation in universal variables:
+
+	        F(x)   = σ₀x²C(ψ) + (1-r₀α)x³S(ψ) + r₀x - √μΔt
+	        F'(x)  = σ₀x(1-ψS(ψ)) + (1-r₀α)x²C(ψ) + r₀
+	        F''(x) = σ₀(1-ψC(ψ)) + (1-r₀α)x(1-ψS(ψ))
+
+	    where ψ=αx², so that only a single evaluation of `stumpff` is needed per step.
+	    */
 	    scalar refine(
     		const scalar x, 
 			const scalar a, 
@@ -140,36 +177,16 @@ namespace orbit {
 	        const scalar x3   = x * x2;
 	        const scalar ax2  = a * x2;
 	        const scalar one_r0a = s1 - r0 * a;
-	        const scalar Cax2 = C(ax2);
-	        const scalar Sax2 = S(ax2);
-	        const scalar dCax2dx_ = dCax2dx(a,x);
-	        const scalar dSax2dx_ = dSax2dx(a,x);
-	        const scalar d2Cax2dx2_ = d2Cax2dx2(a,x);
-	        const scalar d2Sax2dx2_ = d2Sax2dx2(a,x);
-
-	        const scalar F    = sigma0 * x2 * Cax2 + one_r0a * x3 * Sax2 + r0 * x - dtsqrtmu;
-	        const scalar dFdx = 
-        	(
-        		   r0
-        		 + sigma0*x2*dCax2dx_
-        		 + s2*sigma0*x*Cax2
-        		 + x3*(-a*r0 + s1)*dSax2dx_
-        		 + s3*x2*(-a*r0 + s1)*Sax2
-        	);
+	        scalar Cax2, Sax2;
+	        stumpff(ax2, Cax2, Sax2);
+
+	        const scalar F      = sigma0 * x2 * Cax2 + one_r0a * x3 * Sax2 + r0 * x - dtsqrtmu;
+	        const scalar dFdx   = sigma0 * x * (s1 - ax2 * Sax2) + one_r0a * x2 * Cax2 + r0;
+	        const scalar d2Fdx2 = sigma0 * (s1 - ax2 * Cax2) + one_r0a * x * (s1 - ax2 * Sax2);
 
 	        const scalar n   (laguerre_method_n);
 	        const scalar n_1 (n - s1);
 
-	        const scalar d2Fdx2 = 
-			(
-				  sigma0*x2*d2Cax2dx2_
-				+ 4*sigma0*x*dCax2dx_
-				+ 2*sigma0*Cax2
-				+ x3*one_r0a*d2Sax2dx2_
-				+ 6*x2*one_r0a*dSax2dx_ 
-				+ 6*x*one_r0a*Sax2
-			);
-
 	        return -scalar(n) * F / // Laguerre method
 	        	(dFdx + math::sign(dFdx) * std::sqrt(std::abs(n_1 * n_1 * dFdx * dFdx - (n * n_1 * F * d2Fdx2))));
 	    }
@@ -194,12 +211,11 @@ namespace orbit {
 	        return x;
 	    }
 
-	    bool inverse_semi_major_axis(const Universals& orbit) const noexcept {
+	    scalar inverse_semi_major_axis(const Universals& orbit) const noexcept {
 	        const scalar mu = gravitational_constant * orbit.combined_mass;
 	        const scalar r0 = glm::length(orbit.initial_position);
 	        const scalar v0 = glm::length(orbit.initial_velocity);
-	        const scalar a  = s2 / r0 - (v0 * v0) / mu;
-	        return s1/a;
+	        return s2 / r0 - (v0 * v0) / mu; // alpha, the inverse semi-major axis
 	    }
 
 	    bool is_elliptic(const scalar inverse_semi_major_axis) const noexcept {
@@ -210,45 +226,35 @@ namespace orbit {
 	        if (t == s0) {
 	            return State(orbit.initial_position, orbit.initial_velocity);
 	        }
-	        const scalar t0 = orbit.time_offset;
-	        const vec3  R0  = orbit.initial_position;
-	        const vec3  V0  = orbit.initial_velocity;
-	        const scalar mu = gravitational_constant * orbit.combined_mass;
-	        const scalar sqrt_mu = std::sqrt(mu);
-	        const scalar r0 = glm::length(R0);
-	        const scalar v0 = glm::length(V0);
-	        const scalar a  = s2 / r0 - (v0 * v0) / mu; // alpha, the inverse semi-major axis
-	        const scalar sma  = s1/a; // semi-major axis
-	        const scalar p = s2*pi*std::sqrt(sma*sma*sma/mu); // period
-	        const scalar dt = (a > s0 && force_congruence? math::floormod(t,p):t) - t0;
-	        const scalar x = solve(
-	        	/* x0 */ a >= s0? 
-	        		  dt*sqrt_mu*a // elliptic or parabolic
-	        		: math::sign(dt) * std::sqrt(-sma) *
-		                 std::log(
-		                     -s2 * dt * mu /
-		                     (sma*(glm::dot(R0, V0) +
-		                       math::sign(dt) * std::sqrt(-mu*sma) * (s1 - r0 * a)))
-		                 ), // hyperbolic
-	        	a, r0, 
-	        	/* sigma0 */    glm::dot(R0, V0) / sqrt_mu, 
-	        	/* dtsqrtmu */  dt * sqrt_mu 
-	        );
-	        const scalar x2   = x * x;
-	        const scalar x3   = x * x2;
-	        const scalar ax2  = a * x2;
-	        const scalar Cax2 = C(ax2);
-	        const scalar Sax2 = S(ax2);
-	        const vec3 R =
-	            (s1 - x2 / r0 * Cax2) * R0 +
-	            (dt - x3 / sqrt_mu * Sax2) * V0;
-	        const scalar r = glm::length(R);
-	        const vec3 V =
-	            (x * sqrt_mu / (r * r0) * (ax2 * Sax2 - s1)) * R0 +
-	            (s1 - x2 / r * Cax2) * V0;
+	        scalar x0, a, r0, sigma0, dtsqrtmu, dt;
+	        setup(orbit, t, x0, a, r0, sigma0, dtsqrtmu, dt);
+	        const scalar x = solve(x0, a, r0, sigma0, dtsqrtmu);
+	        vec3 R, V;
+	        state_for_solution(orbit, x, a, r0, dt, R, V);
 	        return State(R, V);
 	    }
 
+	    /*
+	    `positions` stores in `out[i]` the position of `orbits[i]` at time `times[i]`, 
+	    which is equivalent to `state(orbits[i], times[i]).position` but is suited to propagating tens of thousands of orbits per frame.
+	    Orbits are distributed across OpenMP threads when compiled with `-fopenmp`.
+	    Orbits are not solved in lockstep, since each step of Laguerre's method branches on ψ to evaluate `stumpff`
+	    and calls cos/sin or cosh/sinh, which GCC only vectorizes through glibc's libmvec under `-ffast-math`,
+	    a flag that no build in this repository uses, and lockstep iteration was measured to be no faster than `state()` on a single core.
+	    */
+	    template<typename Orbits, typename Times, typename Positions>
+	    void positions(const Orbits& orbits, const Times& times, Positions& out) const {
+	        propagate(orbits, times, [&](const std::size_t i, const vec3& R, const vec3&){ out[i] = R; });
+	    }
+
+	    /*
+	    `states` is equivalent to `positions`, but also stores in `velocities[i]` the velocity of `orbits[i]` at time `times[i]`
+	    */
+	    template<typename Orbits, typename Times, typename Positions, typename Velocities>
+	    void states(const Orbits& orbits, const Times& times, Positions& positions, Velocities& velocities) const {
+	        propagate(orbits, times, [&](const std::size_t i, const vec3& R, const vec3& V){ positions[i] = R; velocities[i] = V; });
+	    }
+
 	    Universals advance(const Universals& orbit, const scalar t) const noexcept {
 	        State state_ = state(orbit, t);
 	        return Universals(orbit.combined_mass, s0, state_.position, state_.velocity);
@@ -0,0 +1,81 @@
+
+// C libraries
+#include <cmath>    // std::sin, std::sqrt
+
+// std libraries
+#include <algorithm> // std::max
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include "Universals.hpp"
+#include "UniversalPropagator.hpp"
+
+/*
+`UniversalPropagator_benchmark.cpp` reports the runtime of propagating a population of asteroids and moons to a single time,
+both individually using `UniversalPropagator::state()` and in a batch using `UniversalPropagator::positions()`,
+along with the largest distance between the two, relative to orbital radius.
+Orbits are mostly elliptic with eccentricities up to 0.9, and one in ten is hyperbolic.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`.
+*/
+
+template<typename F>
+double seconds_for(const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    using vec3 = glm::dvec3;
+    using Universals = orbit::Universals<double>;
+
+    const double G(6.674e-11);
+    const double mass_of_sun(1.989e30);
+    const double au(1.496e11);
+    const orbit::UniversalPropagator<double> propagator(G);
+
+    std::cout << "method\tcount\tseconds\torbits/s\terror" << std::endl;
+    for (std::size_t count : {1000, 10000, 100000})
+    {
+        std::vector<Universals> orbits;
+        std::vector<double> times(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const double radius(au * (1.0 + 4.0*std::abs(std::sin(1.3*i))));
+            const double circular_speed(std::sqrt(G*mass_of_sun/radius));
+            const double speed_factor(i%10==0? 1.5 : 1.0 + 0.37*std::abs(std::sin(2.9*i)));
+            orbits.emplace_back(mass_of_sun,
+                vec3(radius, 0.0, 0.0),
+                circular_speed * speed_factor * vec3(0.0, std::cos(0.1*std::sin(3.7*i)), std::sin(0.1*std::sin(3.7*i))));
+            times[i] = 3.15e7 * (1.0 + 10.0*std::abs(std::sin(5.3*i)));
+        }
+
+        std::vector<vec3> individual(count);
+        std::vector<vec3> batched(count);
+        const double individual_seconds = seconds_for([&](){
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                individual[i] = propagator.state(orbits[i], times[i]).position;
+            }
+        });
+        const double batched_seconds = seconds_for([&](){ propagator.positions(orbits, times, batched); });
+
+        double error(0.0);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            error = std::max(error, glm::distance(individual[i], batched[i]) / glm::length(individual[i]));
+        }
+        std::cout << "state()\t" << count << "\t" << individual_seconds << "\t" << double(count)/individual_seconds << "\t" << 0.0 << std::endl;
+        std::cout << "positions()\t" << count << "\t" << batched_seconds << "\t" << double(count)/batched_seconds << "\t" << error << std::endl;
+    }
+    return 0;
+}
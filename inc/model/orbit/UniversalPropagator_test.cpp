@@ -537,5 +537,35 @@ TEST_CASE("UniversalPropagator::state()", "[body]") {
 
 	}
 
+	SECTION("propagator.states() must equal propagator.state() for each orbit") {
+
+		std::vector<Universals> orbits;
+		std::vector<double> times;
+		for (const auto& [m, o] : all_periapsides)
+		{
+			for (const double t : { 0.0, 1e-1, -1e3, 1e5, 3e7 })
+			{
+				orbits.push_back(o);
+				times.push_back(t);
+			}
+		}
+		// ensure the last block of `lane_count` orbits is only partially occupied
+		orbits.push_back(all_periapsides[0].second);
+		times.push_back(1e4);
+
+		std::vector<vec3> positions(orbits.size());
+		std::vector<vec3> velocities(orbits.size());
+		propagator.states(orbits, times, positions, velocities);
+		std::vector<vec3> positions_only(orbits.size());
+		propagator.positions(orbits, times, positions_only);
+
+    	Adapter adapter(propagator, 1e-12, 1e-12);
+		for (std::size_t i = 0; i < orbits.size(); ++i)
+		{
+			CHECK(adapter.equal(propagator.state(orbits[i], times[i]), State(positions[i], velocities[i])));
+			CHECK(positions_only[i] == positions[i]);
+		}
+	}
+
 }
 
@@ -0,0 +1,335 @@
+#pragma once
+
+// C libraries
+#include <cmath>     // std::sin, std::cos
+#include <cstddef>   // std::size_t
+
+// std libraries
+#include <algorithm> // std::min
+#include <vector>    // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>           // *vec3
+#include <glm/mat3x3.hpp>         // *mat3
+#include <glm/geometric.hpp>      // glm::cross, glm::normalize
+#include <glm/gtc/quaternion.hpp> // glm::qua, glm::mat3_cast
+
+#include <math/special.hpp>       // math::floormod
+
+#include "Spin.hpp"
+
+namespace orrery {
+
+	/*
+	`SpinFrames` is a cache of rotations for a population of `Spin`s,
+	so that the frames of every body can be found at once each frame,
+	rather than by calling `Spin::inertial_for_fixed()` per body.
+
+	`Spin::inertial_for_fixed()` composes a precession about the precessional north pole,
+	a tilt about the axis of nutation, and a rotation about the local north pole, using `glm::rotate()` on 4x4 matrices.
+	`SpinFrames` represents each of these as a quaternion, so each costs a single sine and cosine of its half angle.
+	Parameters of spins are stored as a structure of arrays, so that angles and their sines and cosines
+	can be found in loops that are vectorized where the compiler supports vectorized trig.
+
+	For successive frames, `advance()` multiplies the precession and rotation of each body by a quaternion for the change in angle,
+	which is only recalculated if the time step changes, so a step costs two quaternion products per body and no trig,
+	aside from bodies that nutate, whose tilt varies nonlinearly with time and is found in closed form.
+	Quaternions are renormalized every `renormalization_interval` steps to prevent drift in their magnitude.
+	`advance()` does not wrap time for spins that `force_congruence`, so `reset()` should be called to reapply it.
+
+	Bodies are indexed in the order they were added, and `add()` without a spin adds a body whose frame is always the identity,
+	so that bodies may share indices with entities that do not all have spins.
+	*/
+	template <typename scalar, typename duration, glm::qualifier precision = glm::defaultp>
+	class SpinFrames
+	{
+		static constexpr scalar pi = 3.14159265358979323848264338327950288419716;
+		static constexpr scalar turn = scalar(2) * pi;
+		static constexpr scalar s0 = scalar(0);
+		static constexpr scalar half = scalar(0.5);
+
+		using vec3 = glm::vec<3,scalar,precision>;
+		using mat3 = glm::mat<3,3,scalar,precision>;
+		using quat = glm::qua<scalar,precision>;
+
+		// parameters of each body
+		std::vector<vec3> precession_axes;
+		std::vector<vec3> nutation_axes;
+		std::vector<vec3> spin_axes;
+		std::vector<scalar> tilts;
+		std::vector<scalar> nutation_amplitudes;
+		std::vector<scalar> nutation_phases;
+		std::vector<duration> nutation_periods;
+		std::vector<duration> precession_periods;
+		std::vector<duration> spin_periods;
+		std::vector<duration> time_offsets;
+		std::vector<duration> congruence_periods; // zero if congruence is not forced
+		std::vector<std::size_t> nutating;        // indices of bodies whose tilt varies with time
+
+		// state of each body at `time_`
+		std::vector<quat> precessions;
+		std::vector<quat> nutations;
+		std::vector<quat> spins;
+
+		// changes in state of each body for a step of `delta`
+		std::vector<quat> precession_deltas;
+		std::vector<quat> spin_deltas;
+		duration delta;
+
+		// scratch arrays of half angles, then of their sines and cosines
+		std::vector<scalar> precession_angles, precession_sines, precession_cosines;
+		std::vector<scalar> nutation_angles, nutation_sines, nutation_cosines;
+		std::vector<scalar> spin_angles, spin_sines, spin_cosines;
+
+		duration time_;
+		std::size_t steps_since_renormalization;
+
+		static inline scalar angle(const duration time, const duration period) noexcept {
+			return period > duration(0)? turn * scalar(time/period) : s0;
+		}
+
+		static void sincos(const std::vector<scalar>& angles, std::vector<scalar>& sines, std::vector<scalar>& cosines) {
+			const std::size_t count(angles.size());
+			sines.resize(count);
+			cosines.resize(count);
+			const scalar* a = angles.data();
+			scalar* s = sines.data();
+			scalar* c = cosines.data();
+			#ifdef _OPENMP
+			#pragma omp simd
+			#endif
+			for (std::size_t i = 0; i < count; ++i) {
+				s[i] = std::sin(a[i]);
+				c[i] = std::cos(a[i]);
+			}
+		}
+
+		// `nutation` returns the half angle of tilt of the i-th body at time `t`
+		inline scalar nutation(const std::size_t i, const duration t) const noexcept {
+			return half * (tilts[i] + nutation_amplitudes[i] * std::sin(nutation_phases[i] + angle(t, nutation_periods[i])));
+		}
+
+		void push(
+			const vec3& precession_axis, const vec3& nutation_axis, const vec3& spin_axis,
+			const scalar tilt, const scalar nutation_amplitude, const scalar nutation_phase,
+			const duration nutation_period, const duration precession_period, const duration spin_period,
+			const duration time_offset, const duration congruence_period
+		) {
+			if (nutation_amplitude != s0 && nutation_period > duration(0)) {
+				nutating.push_back(tilts.size());
+			}
+			precession_axes.push_back(precession_axis);
+			nutation_axes.push_back(nutation_axis);
+			spin_axes.push_back(spin_axis);
+			tilts.push_back(tilt);
+			nutation_amplitudes.push_back(nutation_amplitude);
+			nutation_phases.push_back(nutation_phase);
+			nutation_periods.push_back(nutation_period);
+			precession_periods.push_back(precession_period);
+			spin_periods.push_back(spin_period);
+			time_offsets.push_back(time_offset);
+			congruence_periods.push_back(congruence_period);
+		}
+
+	public:
+
+		const std::size_t renormalization_interval;
+
+		SpinFrames(const std::size_t renormalization_interval = 64):
+			delta(0),
+			time_(0),
+			steps_since_renormalization(0),
+			renormalization_interval(renormalization_interval)
+		{}
+
+		// the number of bodies that were added
+		inline std::size_t size() const noexcept {
+			return tilts.size();
+		}
+
+		// the time at which frames are currently found
+		inline duration time() const noexcept {
+			return time_;
+		}
+
+		void reserve(const std::size_t count) {
+			precession_axes.reserve(count);
+			nutation_axes.reserve(count);
+			spin_axes.reserve(count);
+			tilts.reserve(count);
+			nutation_amplitudes.reserve(count);
+			nutation_phases.reserve(count);
+			nutation_periods.reserve(count);
+			precession_periods.reserve(count);
+			spin_periods.reserve(count);
+			time_offsets.reserve(count);
+			congruence_periods.reserve(count);
+		}
+
+		void clear() {
+			precession_axes.clear();
+			nutation_axes.clear();
+			spin_axes.clear();
+			tilts.clear();
+			nutation_amplitudes.clear();
+			nutation_phases.clear();
+			nutation_periods.clear();
+			precession_periods.clear();
+			spin_periods.clear();
+			time_offsets.clear();
+			congruence_periods.clear();
+			nutating.clear();
+			precessions.clear();
+			nutations.clear();
+			spins.clear();
+			precession_deltas.clear();
+			spin_deltas.clear();
+			delta = duration(0);
+		}
+
+		/*
+		`add` adds a body with the given `spin`.
+		Frames are undefined until `reset()` is called.
+		*/
+		void add(const Spin<scalar,duration>& spin) {
+			const vec3 nutation_axis(glm::cross(spin.initial_north_pole_in_global_space, spin.precessional_north_pole_in_global_space));
+			// `Spin` is undefined if its initial and precessional north poles are parallel, so such spins are treated as untilted
+			const bool is_tilted(glm::dot(nutation_axis, nutation_axis) > s0);
+			const bool is_nutating(spin.nutation_period > duration(0));
+			push(
+				glm::normalize(spin.precessional_north_pole_in_global_space),
+				is_tilted? glm::normalize(nutation_axis) : vec3(0),
+				glm::normalize(spin.north_pole_in_local_space),
+				is_tilted? spin.mean_axial_tilt_in_radians : s0,
+				is_tilted? spin.nutation_amplitude_in_radians : s0,
+				is_nutating? scalar(spin.initial_nutation_phase_in_radians) : s0,
+				spin.nutation_period,
+				spin.precession_period,
+				spin.spin_period,
+				spin.time_offset,
+				spin.force_congruence? spin.period() : duration(0));
+		}
+
+		// `add` adds a body whose frame is always the identity
+		void add() {
+			push(vec3(0), vec3(0), vec3(0), s0, s0, s0, duration(0), duration(0), duration(0), duration(0), duration(0));
+		}
+
+		// `reset` finds the frame of every body at time `t` in closed form
+		void reset(const duration t) {
+			const std::size_t count(size());
+			time_ = t;
+			steps_since_renormalization = 0;
+			precession_angles.resize(count);
+			nutation_angles.resize(count);
+			spin_angles.resize(count);
+			for (std::size_t i = 0; i < count; ++i) {
+				const duration offset_time(t + time_offsets[i]);
+				const duration local_time(congruence_periods[i] > duration(0)?
+					math::floormod(offset_time, congruence_periods[i]) : offset_time);
+				precession_angles[i] = half * angle(local_time, precession_periods[i]);
+				nutation_angles[i] = nutation(i, local_time);
+				spin_angles[i] = half * angle(local_time, spin_periods[i]);
+			}
+			sincos(precession_angles, precession_sines, precession_cosines);
+			sincos(nutation_angles, nutation_sines, nutation_cosines);
+			sincos(spin_angles, spin_sines, spin_cosines);
+			precessions.resize(count);
+			nutations.resize(count);
+			spins.resize(count);
+			for (std::size_t i = 0; i < count; ++i) {
+				precessions[i] = quat(precession_cosines[i], precession_sines[i] * precession_axes[i]);
+				nutations[i] = quat(nutation_cosines[i], nutation_sines[i] * nutation_axes[i]);
+				spins[i] = quat(spin_cosines[i], spin_sines[i] * spin_axes[i]);
+			}
+		}
+
+		/*
+		`advance` finds the frame of every body at `time()+dt` by incrementally rotating frames from `time()`,
+		where frames must have been found at least once by `reset()`
+		*/
+		void advance(const duration dt) {
+			const std::size_t count(size());
+			if (dt != delta || precession_deltas.size() != count) {
+				delta = dt;
+				for (std::size_t i = 0; i < count; ++i) {
+					precession_angles[i] = half * angle(dt, precession_periods[i]);
+					spin_angles[i] = half * angle(dt, spin_periods[i]);
+				}
+				sincos(precession_angles, precession_sines, precession_cosines);
+				sincos(spin_angles, spin_sines, spin_cosines);
+				precession_deltas.resize(count);
+				spin_deltas.resize(count);
+				for (std::size_t i = 0; i < count; ++i) {
+					precession_deltas[i] = quat(precession_cosines[i], precession_sines[i] * precession_axes[i]);
+					spin_deltas[i] = quat(spin_cosines[i], spin_sines[i] * spin_axes[i]);
+				}
+			}
+			time_ += dt;
+			// rotations about a single axis commute, so deltas can be applied on either side
+			for (std::size_t i = 0; i < count; ++i) {
+				precessions[i] = precessions[i] * precession_deltas[i];
+				spins[i] = spins[i] * spin_deltas[i];
+			}
+			for (std::size_t i : nutating) {
+				const scalar h(nutation(i, time_ + time_offsets[i]));
+				nutations[i] = quat(std::cos(h), std::sin(h) * nutation_axes[i]);
+			}
+			if (++steps_since_renormalization >= renormalization_interval) {
+				steps_since_renormalization = 0;
+				for (std::size_t i = 0; i < count; ++i) {
+					precessions[i] = glm::normalize(precessions[i]);
+					spins[i] = glm::normalize(spins[i]);
+				}
+			}
+		}
+
+		// equivalent to `Spin::inertial_for_fixed(time())` for the i-th body
+		inline mat3 inertial_for_fixed(const std::size_t i) const noexcept {
+			return glm::mat3_cast(precessions[i] * nutations[i] * spins[i]);
+		}
+
+		// equivalent to `Spin::fixed_for_inertial(time())` for the i-th body
+		inline mat3 fixed_for_inertial(const std::size_t i) const noexcept {
+			return glm::mat3_cast(glm::conjugate(precessions[i] * nutations[i] * spins[i]));
+		}
+
+		/*
+		`inertial_for_fixed` stores `inertial_for_fixed(i)` within `results[i]` for every body,
+		where bodies beyond `size()` are assigned the identity matrix
+		*/
+		template<typename mat3s>
+		void inertial_for_fixed(mat3s& results) const {
+			const std::size_t count(std::min(std::size_t(results.size()), size()));
+			#ifdef _OPENMP
+			#pragma omp parallel for
+			#endif
+			for (std::size_t i = 0; i < count; ++i) {
+				results[i] = inertial_for_fixed(i);
+			}
+			for (std::size_t i = count; i < results.size(); ++i) {
+				results[i] = mat3(1);
+			}
+		}
+
+		/*
+		`fixed_for_inertial` stores `fixed_for_inertial(i)` within `results[i]` for every body,
+		where bodies beyond `size()` are assigned the identity matrix
+		*/
+		template<typename mat3s>
+		void fixed_for_inertial(mat3s& results) const {
+			const std::size_t count(std::min(std::size_t(results.size()), size()));
+			#ifdef _OPENMP
+			#pragma omp parallel for
+			#endif
+			for (std::size_t i = 0; i < count; ++i) {
+				results[i] = fixed_for_inertial(i);
+			}
+			for (std::size_t i = count; i < results.size(); ++i) {
+				results[i] = mat3(1);
+			}
+		}
+
+	};
+
+}
@@ -0,0 +1,107 @@
+
+// C libraries
+#include <cmath>    // std::sin, std::cos
+
+// std libraries
+#include <algorithm> // std::max
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/mat3x3.hpp>   // *mat3
+
+// in-house libraries
+#include "Spin.hpp"
+#include "SpinFrames.hpp"
+#include "components/DenseContiguousComponents.hpp"
+#include "systems/SpinSystem.hpp"
+
+/*
+`SpinFrames_benchmark.cpp` reports the runtime of finding the frame of every body in a scene for a single frame,
+either by calling `Spin::fixed_for_inertial()` per body through `SpinSystem`,
+by finding frames in closed form using `SpinFrames::reset()`, or incrementally using `SpinFrames::advance()`,
+along with the largest difference from `Spin::fixed_for_inertial()` after a number of frames.
+Every body precesses, and one in four nutates.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`.
+*/
+
+template<typename F>
+double seconds_for(const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    using id = std::size_t;
+    using vec3 = glm::dvec3;
+    using mat3 = glm::dmat3;
+    using Spin = orrery::Spin<double,double>;
+
+    const orrery::SpinSystem<id,double,double> system;
+    const int frame_count(100);
+    const double dt(1.0/60.0);
+
+    std::cout << "method\tcount\tseconds/frame\tbodies/s\terror" << std::endl;
+    for (std::size_t count : {1000, 10000, 100000})
+    {
+        orrery::DenseContiguousComponents<id,Spin> spins(count, false);
+        for (id i = 0; i < count; ++i)
+        {
+            const vec3 local(0.1*std::sin(1.3*i), 0.0, 1.0);
+            const vec3 precessional(std::sin(0.4*std::sin(2.9*i)), 0.0, std::cos(0.4*std::sin(2.9*i)));
+            spins.add(i, Spin(local, vec3(0,0,1), precessional, 0.4*std::abs(std::sin(3.7*i)), i%4==0? 0.01 : 0.0, 0.5,
+                i%4==0? 18.6 : 0.0, 2.6e4, 0.5 + std::abs(std::sin(5.3*i)), 0.0, false));
+        }
+
+        std::vector<mat3> expected(count);
+        std::vector<mat3> results(count);
+        auto error = [&](){
+            double result(0.0);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    result = std::max(result, glm::length(results[i][j] - expected[i][j]));
+                }
+            }
+            return result;
+        };
+
+        const double individual_seconds = seconds_for([&](){
+            for (int frame = 0; frame < frame_count; ++frame)
+            {
+                system.fixed_for_inertial(spins, frame*dt, expected);
+            }
+        });
+        std::cout << "Spin\t" << count << "\t" << individual_seconds/frame_count << "\t" << double(count*frame_count)/individual_seconds << "\t" << 0.0 << std::endl;
+
+        orrery::SpinFrames<double,double> frames;
+        system.frames(spins, 0.0, frames);
+        const double reset_seconds = seconds_for([&](){
+            for (int frame = 0; frame < frame_count; ++frame)
+            {
+                frames.reset(frame*dt);
+                system.fixed_for_inertial(frames, results);
+            }
+        });
+        std::cout << "reset()\t" << count << "\t" << reset_seconds/frame_count << "\t" << double(count*frame_count)/reset_seconds << "\t" << error() << std::endl;
+
+        frames.reset(0.0);
+        const double advance_seconds = seconds_for([&](){
+            for (int frame = 1; frame < frame_count; ++frame)
+            {
+                frames.advance(dt);
+                system.fixed_for_inertial(frames, results);
+            }
+        });
+        std::cout << "advance()\t" << count << "\t" << advance_seconds/(frame_count-1) << "\t" << double(count*(frame_count-1))/advance_seconds << "\t" << error() << std::endl;
+    }
+    return 0;
+}
+
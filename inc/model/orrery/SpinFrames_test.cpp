@@ -0,0 +1,98 @@
+
+// std libraries
+#include <cmath>    // std::sin, std::cos
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch/catch.hpp>
+
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/mat3x3.hpp>   // *mat3
+
+// in-house libraries
+#include "Spin.hpp"
+#include "SpinFrames.hpp"
+
+TEST_CASE("SpinFrames", "[spin]") {
+
+	using vec3 = glm::dvec3;
+	using mat3 = glm::dmat3;
+	using Spin = orrery::Spin<double,double>;
+
+	auto distance = [](const mat3& a, const mat3& b){
+		double result(0.0);
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				result = std::max(result, std::abs(a[i][j] - b[i][j]));
+			}
+		}
+		return result;
+	};
+
+	// spins vary in tilt, precession, nutation, and whether congruence is forced
+	std::vector<Spin> spins;
+	for (int i = 0; i < 8; ++i)
+	{
+		const vec3 local(std::sin(0.3*i), 0.1, std::cos(0.3*i));
+		const vec3 initial(0.0, 0.0, 1.0);
+		const vec3 precessional(std::sin(0.2*(i+1)), 0.0, std::cos(0.2*(i+1)));
+		spins.push_back(Spin(local, initial, precessional, 0.1*i, i%2? 0.05 : 0.0, 0.7, i%2? 13.0 : 0.0, 100.0 + i, 0.5 + 0.1*i, 0.3*i, i%3==0));
+	}
+	spins.push_back(Spin(vec3(0,0,1), vec3(0,0,1), 0.9, 0.0, false));
+
+	orrery::SpinFrames<double,double> frames(16);
+	for (const Spin& spin : spins)
+	{
+		frames.add(spin);
+	}
+	frames.add();
+
+	SECTION("SpinFrames.reset() must reproduce Spin.inertial_for_fixed() and Spin.fixed_for_inertial()") {
+		for (const double t : {0.0, 0.37, 12.5, -3.1, 250.0})
+		{
+			frames.reset(t);
+			for (std::size_t i = 0; i+1 < spins.size(); ++i)
+			{
+				CHECK(distance(frames.inertial_for_fixed(i), spins[i].inertial_for_fixed(t)) < 1e-9);
+				CHECK(distance(frames.fixed_for_inertial(i), spins[i].fixed_for_inertial(t)) < 1e-9);
+			}
+		}
+	}
+
+	SECTION("SpinFrames.add() must treat spins with parallel initial and precessional poles as untilted") {
+		frames.reset(0.3);
+		const Spin untilted(vec3(0,0,1), vec3(0,0,1), vec3(0,1,0), 0.0, 0.0, 0.9, 0.0, false);
+		CHECK(distance(frames.inertial_for_fixed(spins.size()-1), untilted.inertial_for_fixed(0.3)) < 1e-9);
+	}
+
+	SECTION("SpinFrames.add() without a spin must add a body whose frame is the identity") {
+		frames.reset(4.0);
+		frames.advance(0.1);
+		CHECK(distance(frames.inertial_for_fixed(spins.size()), mat3(1)) < 1e-12);
+		std::vector<mat3> results(spins.size()+3);
+		frames.fixed_for_inertial(results);
+		CHECK(distance(results[spins.size()+2], mat3(1)) < 1e-12);
+	}
+
+	SECTION("SpinFrames.advance() must track Spin.inertial_for_fixed() over many steps of a spin that does not force congruence") {
+		frames.reset(1.0);
+		const double dt(0.01);
+		for (int step = 1; step <= 1000; ++step)
+		{
+			frames.advance(dt);
+		}
+		CHECK(frames.time() == Approx(11.0));
+		for (std::size_t i = 0; i < spins.size(); ++i)
+		{
+			if (!spins[i].force_congruence)
+			{
+				CHECK(distance(frames.inertial_for_fixed(i), spins[i].inertial_for_fixed(frames.time())) < 1e-9);
+			}
+		}
+	}
+
+}
+
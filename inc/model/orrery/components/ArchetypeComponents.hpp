@@ -0,0 +1,385 @@
+#pragma once
+
+#include <cassert>       // assert
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint32_t
+
+#include <limits>        // std::numeric_limits
+#include <tuple>         // std::tuple
+#include <type_traits>   // std::is_same_v
+#include <utility>       // std::index_sequence
+#include <vector>        // std::vector
+
+/*
+`ArchetypeComponents` represents every table of components within an Entity-Component-System ("ECS") pattern at once,
+where entities that own the same set of component types (an "archetype") are stored together.
+Each archetype stores a std::vector for each of its component types, in "structure of arrays" ("SoA") fashion,
+so that the components of a given row all belong to the same entity, which is listed in the same row of `entities`.
+
+Other `*Components` classes store a single component type, and systems that need several component types
+must join them per entity using `has()` and `component_for_entity()`, which for sparse classes is a hash lookup.
+`ArchetypeComponents` instead offers `each()` and `chunks()`, which traverse only the archetypes that own all of the requested types,
+so joins are done per archetype rather than per entity, and traversal within an archetype is in-order and contiguous.
+The cost of this is paid upon `add()` and `remove()`, which move the entity's components to another archetype.
+Moves are done by swapping the last row into the vacated row, so order within an archetype is not preserved.
+
+The location of each entity is stored at the entity's index, as in `DenseContiguousComponents`,
+so `has()` and `component_for_entity()` are O(1) without hashing.
+
+`ArchetypeComponents` is best suited if component sets of entities change infrequently,
+and systems frequently traverse entities that own several component types.
+*/
+
+namespace orrery
+{
+
+template<typename id, typename... Components>
+class ArchetypeComponents
+{
+	using mask = std::uint32_t;
+
+	static_assert(sizeof...(Components) <= 32, "ArchetypeComponents supports at most 32 component types.");
+
+	static constexpr std::size_t absent = std::numeric_limits<std::size_t>::max();
+
+	template<typename Component, std::size_t... I>
+	static constexpr std::size_t type_index(std::index_sequence<I...>)
+	{
+		std::size_t result = absent;
+		((result = std::is_same_v<Component, Components>? I : result), ...);
+		return result;
+	}
+
+	// `column` returns the position of `Component` within `Components`
+	template<typename Component>
+	static constexpr std::size_t column()
+	{
+		constexpr std::size_t result = type_index<Component>(std::index_sequence_for<Components...>());
+		static_assert(result != absent, "Component is not stored by this ArchetypeComponents.");
+		return result;
+	}
+
+	// `mask_for` returns the set of `Required` component types, as a bitmask of their columns
+	template<typename... Required>
+	static constexpr mask mask_for()
+	{
+		return (mask(0) | ... | (mask(1) << column<Required>()));
+	}
+
+	struct Archetype
+	{
+		mask components;
+		std::vector<id> entities;
+		std::tuple<std::vector<Components>...> columns;
+
+		Archetype(const mask components):
+			components(components),
+			entities(),
+			columns()
+		{
+		}
+	};
+
+	std::vector<Archetype> archetypes;
+	// Map from an entity ID to the index of its archetype, or `absent` if the entity owns no components.
+	std::vector<std::size_t> archetype_of_entity;
+	// Map from an entity ID to its row within its archetype.
+	std::vector<std::size_t> row_of_entity;
+
+	// `archetype_for_mask` returns the index of the archetype with the given set of components, creating it if needed
+	std::size_t archetype_for_mask(const mask components)
+	{
+		// archetypes are few, so a linear search is cheaper than hashing
+		for (std::size_t i = 0; i < archetypes.size(); ++i)
+		{
+			if (archetypes[i].components == components)
+			{
+				return i;
+			}
+		}
+		archetypes.emplace_back(components);
+		return archetypes.size() - 1;
+	}
+
+	template<std::size_t I>
+	static void copy_column(const Archetype& from, const std::size_t row, Archetype& to)
+	{
+		constexpr mask bit = mask(1) << I;
+		if ((from.components & bit) && (to.components & bit))
+		{
+			std::get<I>(to.columns).push_back(std::get<I>(from.columns)[row]);
+		}
+	}
+
+	template<std::size_t I>
+	static void erase_column(Archetype& archetype, const std::size_t row)
+	{
+		if (archetype.components & (mask(1) << I))
+		{
+			auto& column = std::get<I>(archetype.columns);
+			if (row + 1 != column.size())
+			{
+				column[row] = column.back();
+			}
+			column.pop_back();
+		}
+	}
+
+	template<std::size_t... I>
+	static void copy_row(const Archetype& from, const std::size_t row, Archetype& to, std::index_sequence<I...>)
+	{
+		(copy_column<I>(from, row, to), ...);
+	}
+
+	template<std::size_t... I>
+	static void erase_row(Archetype& archetype, const std::size_t row, std::index_sequence<I...>)
+	{
+		(erase_column<I>(archetype, row), ...);
+	}
+
+	// `detach` removes the row of `entity` from its archetype, swapping the last row into its place
+	void detach(const id entity)
+	{
+		const std::size_t index = std::size_t(entity);
+		Archetype& archetype = archetypes[archetype_of_entity[index]];
+		const std::size_t row = row_of_entity[index];
+		erase_row(archetype, row, std::index_sequence_for<Components...>());
+		if (row + 1 != archetype.entities.size())
+		{
+			const id moved = archetype.entities.back();
+			archetype.entities[row] = moved;
+			row_of_entity[std::size_t(moved)] = row;
+		}
+		archetype.entities.pop_back();
+		archetype_of_entity[index] = absent;
+	}
+
+	/*
+	`move` moves `entity` to the archetype for `components`,
+	copying any components that are shared by both archetypes, and returns the index of the new archetype.
+	Columns of the new archetype that are not owned by the old archetype must be filled by the caller.
+	*/
+	std::size_t move(const id entity, const mask components)
+	{
+		const std::size_t index = std::size_t(entity);
+		const std::size_t target = archetype_for_mask(components);
+		const std::size_t source = archetype_of_entity[index];
+		if (source != absent)
+		{
+			copy_row(archetypes[source], row_of_entity[index], archetypes[target], std::index_sequence_for<Components...>());
+			detach(entity);
+		}
+		archetype_of_entity[index] = target;
+		row_of_entity[index] = archetypes[target].entities.size();
+		archetypes[target].entities.push_back(entity);
+		return target;
+	}
+
+	template<typename Component>
+	void set(Archetype& archetype, const std::size_t row, const Component& component)
+	{
+		auto& components = std::get<column<Component>()>(archetype.columns);
+		if (row < components.size())
+		{
+			components[row] = component;
+		}
+		else
+		{
+			components.push_back(component);
+		}
+	}
+
+	[[nodiscard]] mask components_of_entity(const id entity) const
+	{
+		const std::size_t index = std::size_t(entity);
+		return index < archetype_of_entity.size() && archetype_of_entity[index] != absent?
+			archetypes[archetype_of_entity[index]].components : mask(0);
+	}
+
+public:
+
+	/*
+	Create an empty `ArchetypeComponents<id,Components...>` instance.
+	*/
+	ArchetypeComponents():
+		archetypes(),
+		archetype_of_entity(),
+		row_of_entity()
+	{
+	}
+
+	/*
+	Create an `ArchetypeComponents<id,Components...>` instance
+	that has memory preallocated to serve a given number of entities.
+	*/
+	ArchetypeComponents(const id& entity_count):
+		archetypes(),
+		archetype_of_entity(std::size_t(entity_count), absent),
+		row_of_entity(std::size_t(entity_count), 0)
+	{
+	}
+
+	void clear()
+	{
+		archetypes.clear();
+		archetype_of_entity.clear();
+		row_of_entity.clear();
+	}
+
+	/*
+	`add` assigns the given components to `entity`, replacing any components of the same type that it already owns.
+	Several components can be added at once, so that the entity moves between archetypes only once.
+	*/
+	template<typename... Added>
+	void add(const id entity, const Added&... components)
+	{
+		const std::size_t index = std::size_t(entity);
+		if (index >= archetype_of_entity.size())
+		{
+			archetype_of_entity.resize(index + 1, absent);
+			row_of_entity.resize(index + 1, 0);
+		}
+
+		const mask existing = components_of_entity(entity);
+		const mask combined = existing | mask_for<Added...>();
+		const std::size_t archetype = existing == combined && archetype_of_entity[index] != absent?
+			archetype_of_entity[index] : move(entity, combined);
+		(set(archetypes[archetype], row_of_entity[index], components), ...);
+	}
+
+	template<typename Component>
+	void remove(const id entity)
+	{
+		assert(has<Component>(entity) && "Removing non-existent component.");
+
+		const mask remaining = components_of_entity(entity) & ~mask_for<Component>();
+		if (remaining == mask(0))
+		{
+			detach(entity);
+		}
+		else
+		{
+			move(entity, remaining);
+		}
+	}
+
+	void entity_destroyed(const id entity)
+	{
+		if (components_of_entity(entity) != mask(0))
+		{
+			detach(entity);
+		}
+	}
+
+	// `entity_count` returns the number of entities tracked by this component store
+	[[nodiscard]] std::size_t entity_count() const
+	{
+		return archetype_of_entity.size();
+	}
+
+	// `archetype_count` returns the number of distinct sets of components that have been owned by entities
+	[[nodiscard]] std::size_t archetype_count() const
+	{
+		return archetypes.size();
+	}
+
+	// `component_count` returns the number of entities that own all of the `Required` component types
+	template<typename... Required>
+	[[nodiscard]] std::size_t component_count() const
+	{
+		constexpr mask required = mask_for<Required...>();
+		std::size_t count = 0;
+		for (const Archetype& archetype : archetypes)
+		{
+			if ((archetype.components & required) == required)
+			{
+				count += archetype.entities.size();
+			}
+		}
+		return count;
+	}
+
+	template<typename... Required>
+	[[nodiscard]] inline bool has(const id entity) const
+	{
+		constexpr mask required = mask_for<Required...>();
+		return (components_of_entity(entity) & required) == required;
+	}
+
+	template<typename Component>
+	[[nodiscard]] const Component& component_for_entity(const id entity) const
+	{
+		assert(has<Component>(entity) && "Retrieving non-existent component.");
+		const std::size_t index = std::size_t(entity);
+		return std::get<column<Component>()>(archetypes[archetype_of_entity[index]].columns)[row_of_entity[index]];
+	}
+
+	template<typename Component>
+	[[nodiscard]] Component& component_for_entity(const id entity)
+	{
+		assert(has<Component>(entity) && "Retrieving non-existent component.");
+		const std::size_t index = std::size_t(entity);
+		return std::get<column<Component>()>(archetypes[archetype_of_entity[index]].columns)[row_of_entity[index]];
+	}
+
+	/*
+	`chunks` calls `f(entities, components...)` once for each archetype that owns all of the `Required` component types,
+	where `entities` is a std::vector of the archetype's entities,
+	and `components...` are std::vectors of the `Required` components whose rows correspond to `entities`.
+	This allows systems to operate on contiguous arrays, e.g. to pass them to batched methods.
+	*/
+	template<typename... Required, typename F>
+	void chunks(F&& f) const
+	{
+		constexpr mask required = mask_for<Required...>();
+		for (const Archetype& archetype : archetypes)
+		{
+			if ((archetype.components & required) == required && !archetype.entities.empty())
+			{
+				f(archetype.entities, std::get<column<Required>()>(archetype.columns)...);
+			}
+		}
+	}
+
+	template<typename... Required, typename F>
+	void chunks(F&& f)
+	{
+		constexpr mask required = mask_for<Required...>();
+		for (Archetype& archetype : archetypes)
+		{
+			if ((archetype.components & required) == required && !archetype.entities.empty())
+			{
+				f(archetype.entities, std::get<column<Required>()>(archetype.columns)...);
+			}
+		}
+	}
+
+	/*
+	`each` calls `f(entity, components...)` for each entity that owns all of the `Required` component types.
+	Entities are visited in order of archetype, and in no particular order within an archetype.
+	*/
+	template<typename... Required, typename F>
+	void each(F&& f) const
+	{
+		chunks<Required...>([&](const std::vector<id>& entities, const std::vector<Required>&... columns){
+			for (std::size_t row = 0; row < entities.size(); ++row)
+			{
+				f(entities[row], columns[row]...);
+			}
+		});
+	}
+
+	template<typename... Required, typename F>
+	void each(F&& f)
+	{
+		chunks<Required...>([&](const std::vector<id>& entities, std::vector<Required>&... columns){
+			for (std::size_t row = 0; row < entities.size(); ++row)
+			{
+				f(entities[row], columns[row]...);
+			}
+		});
+	}
+
+};
+
+}
@@ -0,0 +1,151 @@
+
+// C libraries
+#include <cmath>    // std::sin, std::sqrt
+
+// std libraries
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/mat3x3.hpp>   // *mat3
+
+// in-house libraries
+#include <model/orbit/Universals.hpp>
+#include <model/orrery/Spin.hpp>
+#include <model/orrery/systems/OrbitSystem.hpp>
+#include <model/orrery/systems/SpinSystem.hpp>
+
+#include "DenseContiguousComponents.hpp"
+#include "SparseEnduringComponents.hpp"
+#include "ArchetypeComponents.hpp"
+
+/*
+`ArchetypeComponents_benchmark.cpp` reports the runtime of joining orbits, spins, and lights across a population of entities,
+either by storing each component type in its own `*Components` class and joining them per entity using `has()` and `component_for_entity()`,
+or by storing them together in `ArchetypeComponents` and joining them per archetype using `each()`.
+Orbits and spins are stored in `DenseContiguousComponents` and lights in `SparseEnduringComponents`, since few entities emit light.
+The runtime of `OrbitSystem::offsets()` and `SpinSystem::fixed_for_inertial()` is also reported for either storage.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`.
+*/
+
+struct Light
+{
+    double luminosity;
+};
+
+template<typename F>
+double seconds_for(const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    using id = std::size_t;
+    using vec3 = glm::dvec3;
+    using mat3 = glm::dmat3;
+    using Orbit = orbit::Universals<double>;
+    using Spin = orrery::Spin<double,double>;
+    using Archetypes = orrery::ArchetypeComponents<id, Orbit, Spin, Light>;
+
+    const orbit::UniversalPropagator<double> propagator(1.0);
+    const orrery::OrbitSystem<id,double> orbit_system(propagator, orbit::Properties<double>(vec3(1,0,0), vec3(0,0,1), 1.0, 3.141592653589793238462));
+    const orrery::SpinSystem<id,double,double> spin_system;
+    const int repetition_count(10);
+
+    std::cout << "storage\toperation\tcount\tseconds\tentities/s\tchecksum" << std::endl;
+    for (std::size_t count : {1000, 10000, 100000})
+    {
+        // the first of every ten entities is a root without an orbit, half of entities spin, and one in seven emits light
+        orrery::DenseContiguousComponents<id,Orbit> orbits(count, Orbit(1.0, vec3(1,0,0), vec3(0,1,0)), false);
+        orrery::DenseContiguousComponents<id,Spin> spins(count, false);
+        orrery::SparseEnduringComponents<id,Light> lights;
+        Archetypes archetypes(count);
+        for (id entity = 0; entity < count; ++entity)
+        {
+            const double radius(1.0 + 9.0*std::abs(std::sin(1.3*entity)));
+            const Orbit orbit(1.0, vec3(radius, 0.0, 0.0), vec3(0.0, std::sqrt(1.2/radius), 0.0));
+            const Spin spin(vec3(0,0,1), vec3(0,0,1), vec3(0.0, std::sin(0.4), std::cos(0.4)), 0.4, 1000.0, 0.1 + std::abs(std::sin(2.9*entity)), 0.0);
+            const Light light{1.0 + entity};
+            if (entity % 10 != 0) { orbits.add(entity, orbit); archetypes.add(entity, orbit); }
+            if (entity % 2 == 0)  { spins.add(entity, spin);   archetypes.add(entity, spin); }
+            if (entity % 7 == 0)  { lights.add(entity, light); archetypes.add(entity, light); }
+        }
+
+        auto report = [&](const std::string& storage, const std::string& operation, const double seconds, const double checksum){
+            std::cout << storage << "\t" << operation << "\t" << count << "\t" << seconds << "\t"
+                << double(count*repetition_count)/seconds << "\t" << checksum << std::endl;
+        };
+
+        double checksum(0.0);
+        double seconds = seconds_for([&](){
+            for (int r = 0; r < repetition_count; ++r)
+            {
+                checksum = 0.0;
+                for (id entity = 0; entity < count; ++entity)
+                {
+                    if (orbits.has(entity) && spins.has(entity) && lights.has(entity))
+                    {
+                        checksum += orbits.component_for_entity(entity).combined_mass
+                            * spins.component_for_entity(entity).spin_period
+                            * lights.component_for_entity(entity).luminosity;
+                    }
+                }
+            }
+        });
+        report("separate", "join", seconds, checksum);
+
+        seconds = seconds_for([&](){
+            for (int r = 0; r < repetition_count; ++r)
+            {
+                checksum = 0.0;
+                archetypes.each<Orbit,Spin,Light>([&](const id, const Orbit& orbit, const Spin& spin, const Light& light){
+                    checksum += orbit.combined_mass * spin.spin_period * light.luminosity;
+                });
+            }
+        });
+        report("archetype", "join", seconds, checksum);
+
+        std::vector<mat3> frames(count);
+        seconds = seconds_for([&](){
+            for (int r = 0; r < repetition_count; ++r)
+            {
+                spin_system.fixed_for_inertial(spins, 1.0, frames);
+            }
+        });
+        report("separate", "fixed_for_inertial", seconds, frames[count-2][0][0]);
+
+        seconds = seconds_for([&](){
+            for (int r = 0; r < repetition_count; ++r)
+            {
+                spin_system.fixed_for_inertial(archetypes, 1.0, frames);
+            }
+        });
+        report("archetype", "fixed_for_inertial", seconds, frames[count-2][0][0]);
+
+        orrery::EntityComponents<id,vec3> offsets;
+        seconds = seconds_for([&](){
+            for (int r = 0; r < repetition_count; ++r)
+            {
+                orbit_system.offsets(orbits, 1.0, offsets);
+            }
+        });
+        report("separate", "offsets", seconds, offsets.component_for_index(0).x);
+
+        seconds = seconds_for([&](){
+            for (int r = 0; r < repetition_count; ++r)
+            {
+                orbit_system.offsets(archetypes, 1.0, offsets);
+            }
+        });
+        report("archetype", "offsets", seconds, offsets.component_for_index(0).x);
+    }
+    return 0;
+}
+
@@ -0,0 +1,92 @@
+
+// std libraries
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch/catch.hpp>
+
+// in-house libraries
+#include "ArchetypeComponents.hpp"
+
+TEST_CASE("ArchetypeComponents", "[components]") {
+
+	using Components = orrery::ArchetypeComponents<int, double, char, float>;
+
+	// entities are assigned every combination of the three component types, using the bits of their id
+	const int entity_count(64);
+	Components components;
+	for (int entity = 0; entity < entity_count; ++entity)
+	{
+		if (entity & 1) { components.add(entity, double(entity)); }
+		if (entity & 2) { components.add(entity, char(entity)); }
+		if (entity & 4) { components.add(entity, float(entity)); }
+	}
+
+	SECTION("ArchetypeComponents.has() must indicate whether every requested component was added") {
+		for (int entity = 0; entity < entity_count; ++entity)
+		{
+			CHECK(components.has<double>(entity) == bool(entity & 1));
+			CHECK(components.has<char>(entity) == bool(entity & 2));
+			CHECK(components.has<double,float>(entity) == ((entity & 5) == 5));
+		}
+	}
+
+	SECTION("ArchetypeComponents.component_for_entity() must return components that were added, after entities move between archetypes") {
+		for (int entity = 0; entity < entity_count; ++entity)
+		{
+			if (entity & 1) { CHECK(components.component_for_entity<double>(entity) == double(entity)); }
+			if (entity & 2) { CHECK(components.component_for_entity<char>(entity) == char(entity)); }
+			if (entity & 4) { CHECK(components.component_for_entity<float>(entity) == float(entity)); }
+		}
+	}
+
+	SECTION("ArchetypeComponents.each() must visit every entity that owns all requested components exactly once") {
+		std::vector<int> visits(entity_count, 0);
+		components.each<double,float>([&](const int entity, const double a, const float b){
+			CHECK(a == double(entity));
+			CHECK(b == float(entity));
+			visits[entity]++;
+		});
+		for (int entity = 0; entity < entity_count; ++entity)
+		{
+			CHECK(visits[entity] == ((entity & 5) == 5? 1 : 0));
+		}
+		CHECK(components.component_count<double,float>() == entity_count/4);
+	}
+
+	SECTION("ArchetypeComponents.each() must allow components to be modified") {
+		components.each<char>([](const int entity, char& c){ c = char(-entity); });
+		for (int entity = 0; entity < entity_count; ++entity)
+		{
+			if (entity & 2) { CHECK(components.component_for_entity<char>(entity) == char(-entity)); }
+		}
+	}
+
+	SECTION("ArchetypeComponents.remove() and entity_destroyed() must preserve the components of other entities") {
+		for (int entity = 0; entity < entity_count; entity += 3)
+		{
+			if (entity & 1) { components.remove<double>(entity); }
+			if (entity % 2 == 0) { components.entity_destroyed(entity); }
+		}
+		for (int entity = 0; entity < entity_count; ++entity)
+		{
+			const bool destroyed(entity % 3 == 0 && entity % 2 == 0);
+			const bool removed(entity % 3 == 0 && (entity & 1));
+			CHECK(components.has<double>(entity) == (bool(entity & 1) && !removed && !destroyed));
+			CHECK(components.has<char>(entity) == (bool(entity & 2) && !destroyed));
+			if (components.has<char>(entity)) { CHECK(components.component_for_entity<char>(entity) == char(entity)); }
+			if (components.has<float>(entity)) { CHECK(components.component_for_entity<float>(entity) == float(entity)); }
+		}
+	}
+
+	SECTION("ArchetypeComponents.add() must replace components that already exist") {
+		components.add(7, 1.5, 'x');
+		CHECK(components.component_for_entity<double>(7) == 1.5);
+		CHECK(components.component_for_entity<char>(7) == 'x');
+		CHECK(components.component_for_entity<float>(7) == 7.0f);
+		CHECK(components.archetype_count() == 7);
+	}
+
+}
+
@@ -158,8 +158,8 @@ public:
 
 	[[nodiscard]] const id entity_for_index(std::size_t component) const
 	{
-		assert(component < components.size() && "Retrieving non-existent component.");
-		return index_of_entity.at(component);
+		assert(component < size_ && "Retrieving non-existent component.");
+		return entity_of_index[component];
 	}
 
 	[[nodiscard]] const Component& component_for_index(std::size_t component) const
@@ -6,6 +6,7 @@
 // std libraries
 #include <limits>   // std::numeric_limits
 #include <vector>   // std::vector
+#include <optional> // std::optional
 #include <algorithm>// std::min/max
 #include <utility>  // std::pair
 
@@ -14,6 +15,8 @@
 #include <glm/vec3.hpp>   // *vec3
 
 // in-house libraries
+#include <math/geometric/Spherelike.hpp>
+
 #include <model/light/Exposure.hpp>
 #include <model/light/sources/BlackBodyPointSource.hpp>
 
@@ -33,10 +36,17 @@ namespace orrery
 
         using ids = std::vector<id>;
         using LightExposures = EntityComponents<id,LightExposure>;
+        using LightExposureSlots = std::vector<std::optional<LightExposure>>;
+
+        static constexpr scalar pi = 3.14159265358979323848264338327950288419716;
+
+        const geometric::Spherelike<3,scalar> spheres;
 
     public:
 
-        LightSystem(){}
+        LightSystem():
+            spheres(pi)
+        {}
 
         template <typename vec3s, typename mat3s, typename PointLightSources>
         void sample(
@@ -48,7 +58,7 @@ namespace orrery
             LightExposures& exposures
         ) const {
             exposures.clear();
-            id entity = target;
+            id entity = targets;
             for (id j = 0; j < sources.entity_count(); ++j)
             {
                 auto L = positions[sources.entity_for_index(j)];
@@ -81,6 +91,98 @@ namespace orrery
             }
         }
 
+        /*
+        equivalent to `sample(positions, fixed_for_inertial, targets, sources, time, exposures)`,
+        but targets are sampled in parallel, and sources may be culled if they are too dim or are occluded.
+        `exposures` is resized to hold a slot for every pair of target and source, 
+        where the slot for the i-th target and j-th source is `exposures[i*sources.entity_count()+j]`, 
+        so that threads write to separate slots, and slots of culled sources are left empty.
+        Sources are culled if their irradiance, `luminosity()/(4πr²)`, is less than `min_irradiance`,
+        or if the line segment between source and target intersects any of the spheres 
+        whose centers are `positions[occluders[k]]` and whose radii are `radii[occluders[k]]`, aside from the source or target itself.
+        Culling is disabled by passing a `min_irradiance` of zero and an empty list of `occluders`.
+        */
+        template <typename vec3s, typename mat3s, typename PointLightSources, typename scalars, typename Irradiance>
+        void sample(
+            const vec3s& positions,
+            const mat3s& fixed_for_inertial,
+            const ids& targets,
+            const PointLightSources& sources,
+            const ids& occluders,
+            const scalars& radii,
+            const Irradiance min_irradiance,
+            const Time time,
+            LightExposureSlots& exposures
+        ) const {
+            const std::size_t target_count(targets.size());
+            const std::size_t source_count(sources.entity_count());
+            const bool is_dimness_culled(min_irradiance > Irradiance(0));
+            exposures.resize(target_count * source_count);
+            #ifdef _OPENMP
+            #pragma omp parallel for schedule(dynamic)
+            #endif
+            for (std::size_t i = 0; i < target_count; ++i) {
+                const id entity = targets[i];
+                const vec3 V(positions[entity]);
+                const mat3 frame(fixed_for_inertial[entity]);
+                for (std::size_t j = 0; j < source_count; ++j)
+                {
+                    std::optional<LightExposure>& slot = exposures[i*source_count+j];
+                    slot.reset();
+                    const id source_entity = sources.entity_for_index(j);
+                    const LightSource& source = sources.component_for_index(j);
+                    const vec3 L(positions[source_entity]);
+                    if (is_dimness_culled) {
+                        const scalar r2(glm::dot(V-L, V-L));
+                        if (source.luminosity() / (scalar(4)*pi*r2) < min_irradiance) { continue; }
+                    }
+                    bool is_occluded(false);
+                    for (std::size_t k = 0; k < occluders.size() && !is_occluded; ++k)
+                    {
+                        const id occluder = occluders[k];
+                        is_occluded = occluder != entity && occluder != source_entity &&
+                            spheres.is_intersected_by_line_segment(V, L, vec3(positions[occluder]), scalar(radii[occluder]));
+                    }
+                    if (!is_occluded) {
+                        slot.emplace(source, frame*(V-L), time);
+                    }
+                }
+            }
+        }
+
+        /*
+        equivalent to `sample(positions, fixed_for_inertial, targets, sources, time, exposures)`,
+        but for sources and targets within an `ArchetypeComponents`,
+        where sources are entities that own a `LightSource`, and targets are entities that own a `Target`, e.g. a `Spin`
+        */
+        template <typename Target, typename vec3s, typename mat3s, typename Archetypes>
+        void sample(
+            const vec3s& positions,
+            const mat3s& fixed_for_inertial,
+            const Archetypes& archetypes,
+            const Time time,
+            LightExposures& exposures
+        ) const {
+            exposures.clear();
+            std::vector<id> source_entities;
+            std::vector<LightSource> sources;
+            archetypes.template each<LightSource>([&](const id entity, const LightSource& source){
+                source_entities.push_back(entity);
+                sources.push_back(source);
+            });
+            archetypes.template chunks<Target>([&](const ids& entities, const std::vector<Target>&){
+                for (std::size_t i = 0; i < entities.size(); ++i) {
+                    const id entity = entities[i];
+                    const auto V = positions[entity];
+                    const auto frame = fixed_for_inertial[entity];
+                    for (std::size_t j = 0; j < sources.size(); ++j)
+                    {
+                        exposures.add(entity, LightExposure(sources[j], frame*(V-positions[source_entities[j]]), time));
+                    }
+                }
+            });
+        }
+
     };
 
 }
@@ -0,0 +1,109 @@
+
+// C libraries
+#include <cmath>    // std::sin, std::cos, std::pow
+
+// std libraries
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <optional> // std::optional
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/mat3x3.hpp>   // *mat3
+
+// in-house libraries
+#include <model/light/sources/BlackBodyPointSource.hpp>
+#include <model/orrery/components/EntityComponents.hpp>
+#include <model/orrery/components/SparseEnduringComponents.hpp>
+
+#include "LightSystem.hpp"
+
+/*
+`LightSystem_benchmark.cpp` reports the runtime of sampling the light exposure of every target from every source,
+either serially using `LightSystem::sample()` with `EntityComponents`, 
+or in parallel with preallocated slots, where sources are optionally culled by irradiance or by occlusion.
+Bodies are scattered across radii that are spread logarithmically from 1 to 1000, and sources are stars near the origin,
+the brightest of which is ten million times brighter than the dimmest, as in a multiple star system.
+The fraction of exposures that survive culling is also reported.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Thread counts are controlled using OMP_NUM_THREADS.
+Run using `make benchmark`.
+*/
+
+template<typename F>
+double seconds_for(const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    using vec3 = glm::dvec3;
+    using mat3 = glm::dmat3;
+    using LightSource = light::BlackBodyPointSource<double,double>;
+    using LightExposure = light::Exposure<double,double,LightSource>;
+
+    const orrery::LightSystem<int,double,double,LightSource> system;
+    const int source_count(10);
+    const int occluder_count(100);
+    const double min_irradiance(1e-9);
+
+    std::cout << "method\ttargets\tsources\toccluders\tseconds\texposures/s\tsurviving" << std::endl;
+    for (int target_count : {1000, 10000, 100000})
+    {
+        const int count(source_count + target_count);
+        std::vector<vec3> positions(count);
+        std::vector<double> radii(count);
+        std::vector<mat3> frames(count, mat3(1));
+        orrery::SparseEnduringComponents<int,LightSource> sources;
+        std::vector<int> targets;
+        std::vector<int> occluders;
+        for (int i = 0; i < count; ++i)
+        {
+            const double radius(i < source_count? 0.1*i : std::pow(1000.0, std::abs(std::sin(5.3*i))));
+            const double angle(7.1*i);
+            positions[i] = radius * vec3(std::cos(angle), std::sin(angle), 0.01*std::sin(3.7*i));
+            radii[i] = i < source_count? 0.01 : 0.001 * radius;
+            if (i < source_count) {
+                sources.add(i, LightSource(std::pow(10.0, -0.7*i), 5800.0));
+            } else {
+                targets.push_back(i);
+            }
+            if (i < source_count + occluder_count) {
+                occluders.push_back(i);
+            }
+        }
+        const std::vector<int> no_occluders;
+        const std::size_t pair_count(std::size_t(target_count)*source_count);
+
+        orrery::EntityComponents<int,LightExposure> exposures;
+        std::vector<std::optional<LightExposure>> slots;
+        auto surviving = [&](){
+            std::size_t result(0);
+            for (const auto& slot : slots) { result += slot.has_value(); }
+            return double(result) / double(pair_count);
+        };
+        auto report = [&](const std::string& method, const int occluders, const double seconds, const double surviving){
+            std::cout << method << "\t" << target_count << "\t" << source_count << "\t" << occluders << "\t"
+                << seconds << "\t" << double(pair_count)/seconds << "\t" << surviving << std::endl;
+        };
+
+        double seconds = seconds_for([&](){ system.sample(positions, frames, targets, sources, 0.0, exposures); });
+        report("serial", 0, seconds, 1.0);
+
+        seconds = seconds_for([&](){ system.sample(positions, frames, targets, sources, no_occluders, radii, 0.0, 0.0, slots); });
+        report("slots", 0, seconds, surviving());
+
+        seconds = seconds_for([&](){ system.sample(positions, frames, targets, sources, no_occluders, radii, min_irradiance, 0.0, slots); });
+        report("slots, irradiance culled", 0, seconds, surviving());
+
+        seconds = seconds_for([&](){ system.sample(positions, frames, targets, sources, occluders, radii, min_irradiance, 0.0, slots); });
+        report("slots, irradiance and occlusion culled", occluder_count, seconds, surviving());
+    }
+    return 0;
+}
+
@@ -0,0 +1,74 @@
+
+// std libraries
+#include <optional> // std::optional
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch/catch.hpp>
+
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/mat3x3.hpp>   // *mat3
+#include <glm/geometric.hpp>// glm::distance
+
+// in-house libraries
+#include <model/light/sources/BlackBodyPointSource.hpp>
+#include <model/orrery/components/EntityComponents.hpp>
+#include <model/orrery/components/SparseEnduringComponents.hpp>
+
+#include "LightSystem.hpp"
+
+TEST_CASE("LightSystem::sample()", "[light]") {
+
+	using vec3 = glm::dvec3;
+	using mat3 = glm::dmat3;
+	using LightSource = light::BlackBodyPointSource<double,double>;
+	using LightExposure = light::Exposure<double,double,LightSource>;
+
+	const orrery::LightSystem<int,double,double,LightSource> system;
+
+	// a star at the origin, a planet eclipsed by a moon, an uneclipsed planet, and a distant dim star
+	const std::vector<vec3> positions{ vec3(0,0,0), vec3(10,0,0), vec3(5,0.5,0), vec3(0,10,0), vec3(-1000,0,0) };
+	const std::vector<double> radii{ 0.5, 0.1, 1.0, 0.1, 0.5 };
+	const std::vector<mat3> frames(positions.size(), mat3(1));
+	orrery::SparseEnduringComponents<int,LightSource> sources;
+	sources.add(0, LightSource(1.0, 5800.0));
+	sources.add(4, LightSource(1.0, 3000.0));
+	const std::vector<int> targets{ 1, 3 };
+	const std::vector<int> no_occluders;
+	const std::vector<int> occluders{ 0, 1, 2, 3, 4 };
+
+	std::vector<std::optional<LightExposure>> slots;
+
+	SECTION("LightSystem.sample() must match the serial overload if nothing is culled") {
+		orrery::EntityComponents<int,LightExposure> expected;
+		system.sample(positions, frames, targets, sources, 0.0, expected);
+		system.sample(positions, frames, targets, sources, no_occluders, radii, 0.0, 0.0, slots);
+		REQUIRE(slots.size() == expected.size());
+		for (std::size_t i = 0; i < slots.size(); ++i)
+		{
+			REQUIRE(slots[i].has_value());
+			CHECK(glm::distance(slots[i]->offset, expected.component_for_index(i).offset) < 1e-12);
+		}
+	}
+
+	SECTION("LightSystem.sample() must cull sources that are occluded by spheres other than the source and target") {
+		system.sample(positions, frames, targets, sources, occluders, radii, 0.0, 0.0, slots);
+		REQUIRE(slots.size() == 4);
+		CHECK(!slots[0].has_value()); // planet 1 is eclipsed from the star by the moon
+		CHECK(!slots[1].has_value()); // planet 1 is eclipsed from the distant star by the star
+		CHECK(slots[2].has_value());
+		CHECK(slots[3].has_value());
+	}
+
+	SECTION("LightSystem.sample() must cull sources whose irradiance is below a threshold") {
+		const double min_irradiance(1e-5); // between the irradiance of the near star (~8e-4) and the distant star (~8e-8)
+		system.sample(positions, frames, targets, sources, no_occluders, radii, min_irradiance, 0.0, slots);
+		CHECK(slots[0].has_value());
+		CHECK(!slots[1].has_value());
+		CHECK(slots[2].has_value());
+		CHECK(!slots[3].has_value());
+	}
+
+}
+
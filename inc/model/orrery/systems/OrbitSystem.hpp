@@ -14,6 +14,7 @@
 #include <model/orbit/Properties.hpp> // orbit::Properties
 #include <model/orbit/Universals.hpp> // orbit::Universals
 #include <model/orbit/UniversalPropagator.hpp> // orbit::UniversalPropagator
+#include <model/orbit/PeriodicSamples.hpp> // orbit::PeriodicSamples
 
 #include <model/orrery/components/EntityComponents.hpp>
 #include <model/orrery/components/DenseContiguousComponents.hpp>
@@ -34,6 +35,7 @@ namespace orrery
         using Orbit = orbit::Universals<scalar>;
 
         using Orbits = DenseContiguousComponents<id, Orbit>;
+        using Samples = orbit::PeriodicSamples<scalar>;
         using TrackPositions = EntityComponents<id,vec3>;
         using Periods = EntityComponents<id,duration>;
 
@@ -76,6 +78,56 @@ namespace orrery
             }
         }
 
+        // OⁿTᵐ → Sᵐ
+        // samples each periodic orbit across its period, so that offsets can later be found by interpolation,
+        // and returns the greatest estimated error of interpolation, as returned by `PeriodicSamples::build()`
+        // this is motivated by scenes with thousands of small moons, whose orbits are costly to solve every frame
+        scalar samples(
+            const Orbits& orbits,
+            const Periods& periods,
+            Samples& samples
+        ) const {
+            std::vector<Orbit> periodic_orbits;
+            std::vector<scalar> periodic_periods;
+            periodic_orbits.reserve(periods.size());
+            periodic_periods.reserve(periods.size());
+            for (std::size_t i = 0; i < periods.size(); ++i) {
+                periodic_orbits.push_back(orbits.component_for_entity(periods.entity_for_index(i)));
+                periodic_periods.push_back(periods.component_for_index(i));
+            }
+            return samples.build(propagator, periodic_orbits, periodic_periods);
+        }
+
+        // SᵐTᵐ… → (Nℝ³)ᵐ
+        // equivalent to `offsets(orbits, periods, fractions, results)`, but interpolates samples that were generated by `samples()`
+        void offsets(
+            const Periods& periods,
+            const Samples& samples,
+            const std::vector<scalar>& fractions,
+            TrackPositions& results
+        ) const {
+            results.clear();
+            results.reserve(periods.size());
+            for (std::size_t i = 0; i < periods.size(); ++i) {
+                results.add(periods.entity_for_index(i), samples.position(i, fractions[i] * periods.component_for_index(i)));
+            }
+        }
+
+        // SᵐTᵐt → (Nℝ³)ᵐ
+        // equivalent to `offsets(orbits, periods, time_offset, results)`, but interpolates samples that were generated by `samples()`
+        void offsets(
+            const Periods& periods,
+            const Samples& samples,
+            const scalar time_offset,
+            TrackPositions& results
+        ) const {
+            results.clear();
+            results.reserve(periods.size());
+            for (std::size_t i = 0; i < periods.size(); ++i) {
+                results.add(periods.entity_for_index(i), samples.position(i, time_offset));
+            }
+        }
+
         // Oⁿ… → (Nℝ³)ᵐ
         // generates barycentric offsets for each cyclic orbit and configuration
         // this is motivated by the need to quickly track imperceptible elliptic orbits
@@ -168,6 +220,24 @@ namespace orrery
             }
         }
 
+        // OⁿNᵐt→(Nℝ³)ᵐ
+        // equivalent to `offsets(orbits, time_offset, results)`, but for orbits within an `ArchetypeComponents`,
+        // where orbits of each archetype are already contiguous, so they are visited in order without checking `has()` for each entity
+        template<typename Archetypes>
+        void offsets(
+            const Archetypes& archetypes,
+            const scalar time_offset,
+            TrackPositions& results
+        ) const {
+            results.clear();
+            results.reserve(archetypes.template component_count<Orbit>());
+            archetypes.template chunks<Orbit>([&](const std::vector<id>& entities, const std::vector<Orbit>& orbits){
+                for (std::size_t i = 0; i < entities.size(); ++i) {
+                    results.add(entities[i], propagator.state(orbits[i], time_offset).position); // TODO: add logic to consider time offsets in the orbit itself
+                }
+            });
+        }
+
     };
 
     /*
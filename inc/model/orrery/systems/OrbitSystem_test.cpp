@@ -0,0 +1,104 @@
+// std libraries
+#include <cmath>    // std::sqrt, std::sin, std::abs
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch/catch.hpp>
+
+#include <glm/vec3.hpp>     // *vec3
+#include <glm/geometric.hpp>// glm::distance
+
+// in-house libraries
+#include <model/orbit/Properties.hpp>
+#include <model/orbit/Universals.hpp>
+#include <model/orbit/UniversalPropagator.hpp>
+#include <model/orbit/PeriodicSamples.hpp>
+#include <model/orrery/components/EntityComponents.hpp>
+#include <model/orrery/components/DenseContiguousComponents.hpp>
+
+#include "OrbitSystem.hpp"
+
+TEST_CASE("OrbitSystem::offsets() for PeriodicSamples", "[orrery]") {
+
+	using vec3 = glm::dvec3;
+	using Orbit = orbit::Universals<double>;
+
+	constexpr double pi = 3.141592653589793238462;
+
+	// orbits are given in units where G=1, about a body of unit mass, starting at periapsis with eccentricities from 0 to 0.8,
+	// and entity 0 is a root without an orbit
+	const orbit::UniversalPropagator<double> propagator(1.0);
+	const orbit::Properties<double> elliptics(vec3(1,0,0), vec3(0,0,1), 1.0, pi);
+	const orrery::OrbitSystem<int,double> system(propagator, elliptics);
+	const int entity_count(6);
+	orrery::DenseContiguousComponents<int,Orbit> orbits(entity_count, false);
+	orrery::EntityComponents<int,double> periods;
+	std::vector<double> radii;
+	std::vector<double> expected_periods;
+	for (int entity = 1; entity < entity_count; ++entity)
+	{
+		const double eccentricity(0.2 * (entity-1));
+		const double r0(1.0 + entity);
+		const double semi_major_axis(r0 / (1.0 - eccentricity));
+		orbits.add(entity, Orbit(1.0, vec3(r0, 0.0, 0.0), vec3(0.0, std::sqrt((1.0 + eccentricity)/r0), 0.0)));
+		expected_periods.push_back(elliptics.period_from_semi_major_axis(semi_major_axis, 1.0));
+		radii.push_back(semi_major_axis * (1.0 + eccentricity));
+	}
+	std::vector<bool> aperiodic(entity_count, false);
+	system.periods(orbits, periods, aperiodic);
+
+	const double tolerance(1e-6);
+	orbit::PeriodicSamples<double> samples(tolerance);
+	const double max_error(system.samples(orbits, periods, samples));
+
+	orrery::EntityComponents<int,vec3> solved;
+	orrery::EntityComponents<int,vec3> interpolated;
+
+	SECTION("OrbitSystem.periods() must find the period of every elliptic orbit") {
+		CHECK(aperiodic[0]);
+		REQUIRE(periods.size() == expected_periods.size());
+		for (std::size_t i = 0; i < periods.size(); ++i)
+		{
+			CHECK(periods.entity_for_index(i) == int(i+1));
+			CHECK(!aperiodic[i+1]);
+			CHECK(std::abs(periods.component_for_index(i) - expected_periods[i]) / expected_periods[i] < 1e-9);
+		}
+	}
+
+	SECTION("OrbitSystem.samples() must report an error within tolerance") {
+		CHECK(samples.size() == periods.size());
+		CHECK(max_error <= tolerance);
+	}
+
+	SECTION("OrbitSystem.offsets() must approximate solved offsets when interpolating samples at a time offset") {
+		for (const double time_offset : {0.3, 7.0, -12.5, 100.0})
+		{
+			system.offsets(orbits, periods, time_offset, solved);
+			system.offsets(periods, samples, time_offset, interpolated);
+			REQUIRE(interpolated.size() == solved.size());
+			for (std::size_t i = 0; i < solved.size(); ++i)
+			{
+				CHECK(interpolated.entity_for_index(i) == solved.entity_for_index(i));
+				CHECK(glm::distance(interpolated.component_for_index(i), solved.component_for_index(i)) / radii[i] < 2.0 * tolerance);
+			}
+		}
+	}
+
+	SECTION("OrbitSystem.offsets() must approximate solved offsets when interpolating samples at fractions of periods") {
+		std::vector<double> fractions;
+		for (std::size_t i = 0; i < periods.size(); ++i)
+		{
+			fractions.push_back(0.5 + 0.49 * std::sin(1.7*i));
+		}
+		system.offsets(orbits, periods, fractions, solved);
+		system.offsets(periods, samples, fractions, interpolated);
+		REQUIRE(interpolated.size() == solved.size());
+		for (std::size_t i = 0; i < solved.size(); ++i)
+		{
+			CHECK(interpolated.entity_for_index(i) == solved.entity_for_index(i));
+			CHECK(glm::distance(interpolated.component_for_index(i), solved.component_for_index(i)) / radii[i] < 2.0 * tolerance);
+		}
+	}
+
+}
@@ -14,6 +14,8 @@
 
 // in-house libraries
 #include <model/orrery/Spin.hpp>
+#include <model/orrery/SpinFrames.hpp>
+#include <model/orrery/components/EntityComponents.hpp>
 #include <model/orrery/components/DenseContiguousComponents.hpp>
 
 namespace orrery
@@ -28,6 +30,7 @@ namespace orrery
 
         using Spins = DenseContiguousComponents<id, orrery::Spin<scalar,duration>>;
         using Periods = EntityComponents<id,duration>;
+        using Frames = SpinFrames<scalar,duration,precision>;
 
     public:
 
@@ -74,6 +77,76 @@ namespace orrery
             }
         }
 
+        // Sⁿt → Fⁿ
+        // stores the spin of each entity within `frames` and finds their frames at `time_offset`, 
+        // where entities without spins are assigned identity frames, so that frames are indexed by entity.
+        // Frames for later times can then be found by `frames.advance()`, which is motivated by the need to find frames of every body every frame
+        void frames(
+            const Spins& spins,
+            const scalar time_offset,
+            Frames& frames
+        ) const {
+            frames.clear();
+            frames.reserve(spins.entity_count());
+            for (std::size_t i = 0; i < spins.entity_count(); ++i) {
+                if (spins.has(i)) {
+                    frames.add(spins.component_for_entity(i));
+                } else {
+                    frames.add();
+                }
+            }
+            frames.reset(time_offset);
+        }
+
+        // equivalent to `fixed_for_inertial(spins, frames.time(), results)`, but for frames that were generated by `frames()`
+        template<typename matrices>
+        void fixed_for_inertial(
+            const Frames& frames,
+            matrices& results
+        ) const {
+            frames.fixed_for_inertial(results);
+        }
+
+        // equivalent to `inertial_for_fixed(spins, frames.time(), results)`, but for frames that were generated by `frames()`
+        template<typename matrices>
+        void inertial_for_fixed(
+            const Frames& frames,
+            matrices& results
+        ) const {
+            frames.inertial_for_fixed(results);
+        }
+
+        // equivalent to `fixed_for_inertial(spins, time_offset, results)`, but for spins within an `ArchetypeComponents`,
+        // where results are indexed by entity, and entities without spins are assigned the identity matrix
+        template<typename Archetypes, typename matrices>
+        void fixed_for_inertial(
+            const Archetypes& archetypes,
+            const scalar time_offset,
+            matrices& results
+        ) const {
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                results[i] = mat3(1);
+            }
+            archetypes.template each<orrery::Spin<scalar,duration>>([&](const id entity, const orrery::Spin<scalar,duration>& spin){
+                results[entity] = spin.fixed_for_inertial(time_offset);
+            });
+        }
+
+        // equivalent to `inertial_for_fixed(spins, time_offset, results)`, but for spins within an `ArchetypeComponents`
+        template<typename Archetypes, typename matrices>
+        void inertial_for_fixed(
+            const Archetypes& archetypes,
+            const scalar time_offset,
+            matrices& results
+        ) const {
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                results[i] = mat3(1);
+            }
+            archetypes.template each<orrery::Spin<scalar,duration>>([&](const id entity, const orrery::Spin<scalar,duration>& spin){
+                results[entity] = spin.inertial_for_fixed(time_offset);
+            });
+        }
+
     };
 
 }
@@ -20,7 +20,7 @@ namespace rock{
             ops(ops)
         {}
 
-        auto operator()(const ColumnSummary& summary) const
+        auto operator()(const auto& summary) const
         {
             return property(ops.flatten(summary));
         }
@@ -40,7 +40,7 @@ namespace rock{
             mantle_density(mantle_density)
         {}
 
-        auto operator()(const ColumnSummary& summary) const
+        auto operator()(const auto& summary) const
         {
             return summary.thickness() * (1.0f - summary.density()/mantle_density);
         }
@@ -50,52 +50,52 @@ namespace rock{
     struct ColumnSummaryExists
     {
         constexpr ColumnSummaryExists(){}
-        inline auto operator()(const ColumnSummary& summary) const { return summary.exists(); }
+        inline auto operator()(const auto& summary) const { return summary.exists(); }
     };
 
     struct ColumnSummaryAreaDensity
     {
         constexpr ColumnSummaryAreaDensity(){}
-        inline auto operator()(const ColumnSummary& summary) const { return summary.area_density(); }
+        inline auto operator()(const auto& summary) const { return summary.area_density(); }
     };
 
     struct ColumnSummaryThickness
     {
         constexpr ColumnSummaryThickness(){}
-        inline auto operator()(const ColumnSummary& summary) const { return summary.thickness(); }
+        inline auto operator()(const auto& summary) const { return summary.thickness(); }
     };
 
     struct ColumnSummaryDensity
     {
         constexpr ColumnSummaryDensity(){}
-        inline auto operator()(const ColumnSummary& summary) const { return summary.density(); }
+        inline auto operator()(const auto& summary) const { return summary.density(); }
     };
 
     struct ColumnSummaryPlateCount
     {
         constexpr ColumnSummaryPlateCount(){}
-        inline auto operator()(const ColumnSummary& summary) const { return summary.plate_count(); }
+        inline auto operator()(const auto& summary) const { return summary.plate_count(); }
     };
 
     struct ColumnSummaryIncludesPlate
     {
         const int plate_id;
         constexpr ColumnSummaryIncludesPlate(const int plate_id): plate_id(plate_id){}
-        inline auto operator()(const ColumnSummary& summary) const { return summary.includes(plate_id); }
+        inline auto operator()(const auto& summary) const { return summary.includes(plate_id); }
     };
 
     struct ColumnSummaryIsPlateOnTop
     {
         const int plate_id;
         constexpr ColumnSummaryIsPlateOnTop(const int plate_id): plate_id(plate_id){}
-        inline auto operator()(const ColumnSummary& summary) const { return summary.is_top(plate_id); }
+        inline auto operator()(const auto& summary) const { return summary.is_top(plate_id); }
     };
 
     struct ColumnSummaryIsPlateSubducted
     {
         const int plate_id;
         constexpr ColumnSummaryIsPlateSubducted(const int plate_id): plate_id(plate_id){}
-        inline auto operator()(const ColumnSummary& summary) const { return summary.is_subducted(plate_id); }
+        inline auto operator()(const auto& summary) const { return summary.is_subducted(plate_id); }
     };
 
 }
@@ -2,7 +2,8 @@
 
 // c libraries
 #include <cmath>   // std::abs
-#include <cstddef> // std::size_t
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdint> // std::uint8_t
 
 // standard libraries
 #include <queue>   // std::priority_queue
@@ -115,6 +116,7 @@ namespace rock
         const iterated::Ternary ternary;
         const iterated::Identity copy;
         const id max_plate_start_count;
+        const id candidates_per_round;
 
         CrustFracturing():
             fill(
@@ -126,7 +128,8 @@ namespace rock
             metric3(adapted::GlmMetric{}),
             ternary(),
             copy(),
-            max_plate_start_count(30)
+            max_plate_start_count(30),
+            candidates_per_round(16)
         {}
 
         template<typename Grid>
@@ -142,17 +145,19 @@ namespace rock
             return fractures;
         }
 
-        template<typename Grid, typename VectorRaster>
-        void fracture(
+        /*
+        `seed` places the seed of each fracture at the largest stress that is not yet claimed,
+        and grows it for a fixed number of steps so that the next seed is placed elsewhere.
+        */
+        template<typename Grid, typename VectorRaster, typename Mask>
+        void seed(
             const Grid& grid, 
             const VectorRaster& stress, 
+            Mask& is_considered,
             Fractures& fractures
         ) const {
-
-            // segmentation
             std::vector<scalar> lengths(stress.size());
             metric3.length(stress, lengths);
-            std::vector<bool> is_considered(stress.size(), true);
             for(std::size_t j(0); j<fractures.size(); j++)
             {
                 fill.reset(id(order.max_id(lengths)), fractures[j]);
@@ -162,6 +167,18 @@ namespace rock
                 }
                 ternary(is_considered, lengths, procedural::uniform(0), lengths);
             }
+        }
+
+        template<typename Grid, typename VectorRaster>
+        void fracture(
+            const Grid& grid, 
+            const VectorRaster& stress, 
+            Fractures& fractures
+        ) const {
+
+            // segmentation
+            std::vector<bool> is_considered(stress.size(), true);
+            seed(grid, stress, is_considered, fractures);
 
             std::size_t candidate_count;
             do {
@@ -178,6 +195,118 @@ namespace rock
 
         }
 
+        /*
+        `fracture_in_parallel` produces fractures in the same manner as `fracture`,
+        but grows all fractures concurrently in bulk-synchronous rounds.
+        Within a round, each fracture pops up to `candidates_per_round` of its candidates
+        and proposes the similar neighbors of those candidates that were unclaimed at the start of the round.
+        A cell that is proposed by several fractures is given to the proposal of lowest priority, 
+        then to the fracture of lowest id, so results do not depend on the number of threads.
+        Seeds are placed exactly as in `fracture`, and each cell is still included in at most one fracture,
+        but since fractures only see each other's claims at the end of a round rather than after every step,
+        they grow in a different order, and the cells assigned to each fracture may differ from those of `fracture` anywhere,
+        not only where fractures meet.
+        */
+        template<typename Grid, typename VectorRaster>
+        void fracture_in_parallel(
+            const Grid& grid, 
+            const VectorRaster& stress, 
+            Fractures& fractures
+        ) const {
+
+            using Candidate = typename Fracture::Candidate;
+
+            // bytes rather than bits, so that fractures can write to distinct cells concurrently
+            std::vector<std::uint8_t> is_considered(stress.size(), std::uint8_t(1));
+            seed(grid, stress, is_considered, fractures);
+
+            const id N(grid.arrows_per_vertex);
+            const std::ptrdiff_t fracture_count(fractures.size());
+            std::vector<std::vector<Candidate>> proposals(fractures.size());
+            std::vector<scalar> claimed_priority(stress.size());
+            std::vector<id> claimed_by(stress.size());
+            std::vector<std::size_t> claimed_round(stress.size(), 0);
+
+            std::size_t round(0);
+            std::size_t candidate_count;
+            do {
+                ++round;
+
+                // propose, reading only state from the start of the round
+                #ifdef _OPENMP
+                #pragma omp parallel for schedule(dynamic)
+                #endif
+                for (std::ptrdiff_t j = 1; j < fracture_count; ++j)
+                {
+                    Fracture& fracture(fractures[j]);
+                    proposals[j].clear();
+                    for (id k = 0; k < candidates_per_round && fracture.candidates.size() > 0; ++k)
+                    {
+                        const id cell_id(fracture.candidates.top().first);
+                        fracture.candidates.pop();
+                        for (id i = 0; i < N; ++i)
+                        {
+                            const id neighbor_id(grid.arrow_target_id(cell_id,i));
+                            if (is_considered[neighbor_id] && fill.is_similar(
+                                    grid.vertex_position(cell_id), stress[cell_id], 
+                                    grid.vertex_position(neighbor_id), stress[neighbor_id],
+                                    grid.vertex_position(fracture.seed_id)))
+                            {
+                                proposals[j].emplace_back(neighbor_id, 
+                                    fill.priority(
+                                        grid.vertex_position(cell_id), stress[cell_id], 
+                                        grid.vertex_position(neighbor_id), stress[neighbor_id],
+                                        grid.vertex_position(fracture.seed_id)));
+                            }
+                        }
+                    }
+                }
+
+                // resolve contested cells, visiting fractures in order of id so that ties go to the lowest id
+                for (std::ptrdiff_t j = 1; j < fracture_count; ++j)
+                {
+                    for (const Candidate& proposal : proposals[j])
+                    {
+                        const id cell_id(proposal.first);
+                        if (claimed_round[cell_id] != round || proposal.second < claimed_priority[cell_id])
+                        {
+                            claimed_round[cell_id] = round;
+                            claimed_priority[cell_id] = proposal.second;
+                            claimed_by[cell_id] = id(j);
+                        }
+                    }
+                }
+
+                // accept, where each cell is written only by the fracture that claimed it
+                #ifdef _OPENMP
+                #pragma omp parallel for schedule(dynamic)
+                #endif
+                for (std::ptrdiff_t j = 1; j < fracture_count; ++j)
+                {
+                    Fracture& fracture(fractures[j]);
+                    for (const Candidate& proposal : proposals[j])
+                    {
+                        const id cell_id(proposal.first);
+                        if (claimed_by[cell_id] == id(j) && 
+                            claimed_priority[cell_id] == proposal.second && 
+                            !fracture.is_included[cell_id])
+                        {
+                            is_considered[cell_id] = 0;
+                            fracture.is_included[cell_id] = true;
+                            fracture.candidates.push(proposal);
+                        }
+                    }
+                }
+
+                candidate_count = 0;
+                for (std::size_t j(1); j < fractures.size(); ++j)
+                {
+                  candidate_count += fractures[j].candidates.size();
+                }
+            } while(candidate_count > 0);
+
+        }
+
         template<typename Fractures>
         void counts(
             const Fractures& fractures,
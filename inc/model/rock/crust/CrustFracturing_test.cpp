@@ -3,6 +3,10 @@
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
 #include <catch/catch.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>    // omp_set_num_threads, omp_get_max_threads
+#endif
+
 // glm libraries
 
 // in-house libraries
@@ -135,5 +139,38 @@ TEST_CASE( "CrustFracturing", "[rock]" ) {
     fracturing.sizes(fractures, plate_sizes);
     REQUIRE(order.not_equal(procedural::uniform(0), plate_sizes));
 
+    // FRACTURE IN PARALLEL
+    std::vector<unlayered::FloodFillState<int,float>> parallel_fractures(plate_count, 
+        unlayered::FloodFillState<int,float>(0, coarse.vertex_count()));
+    fracturing.fracture_in_parallel(coarse, vertex_gradient, parallel_fractures);
+
+    fracturing.counts(parallel_fractures, plate_counts);
+    REQUIRE(order.less_than_equal(plate_counts, procedural::uniform(1)));
+
+    fracturing.sizes(parallel_fractures, plate_sizes);
+    REQUIRE(order.not_equal(procedural::uniform(0), plate_sizes));
+
+    // TEST THAT PARALLEL FRACTURING DOES NOT DEPEND ON THREAD COUNT
+    #ifdef _OPENMP
+    const int thread_count(omp_get_max_threads());
+    #endif
+    for (int threads : {1, 2, 3, 4})
+    {
+        #ifdef _OPENMP
+        omp_set_num_threads(threads);
+        REQUIRE(omp_get_max_threads() == threads);
+        #endif
+        std::vector<unlayered::FloodFillState<int,float>> repeated_fractures(plate_count, 
+            unlayered::FloodFillState<int,float>(0, coarse.vertex_count()));
+        fracturing.fracture_in_parallel(coarse, vertex_gradient, repeated_fractures);
+        for (int i = 0; i < plate_count; ++i)
+        {
+            REQUIRE(parallel_fractures[i].is_included == repeated_fractures[i].is_included);
+        }
+    }
+    #ifdef _OPENMP
+    omp_set_num_threads(thread_count);
+    #endif
+
 }
 
@@ -84,6 +84,7 @@ namespace rock {
         {}
 
 
+		template<typename FormationSummary>
 		void buoyancy(
 			const FormationSummary& summary,
 			pressures& buoyancy_pressure
@@ -138,7 +139,7 @@ namespace rock {
 		    }
 		}
 
-		template<typename Grid>
+		template<typename Grid, typename FormationSummary>
 		volume slab_volume(
 			const Grid& grid,
 			const FormationSummary& summary,
@@ -156,7 +157,7 @@ namespace rock {
 			return slab_volume;
 		}
 
-		template<typename Grid>
+		template<typename Grid, typename FormationSummary>
 		area slab_area(
 			const Grid& grid,
 			const FormationSummary& summary,
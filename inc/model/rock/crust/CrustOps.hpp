@@ -1,7 +1,8 @@
 #pragma once
 
 // std libraries
-#include <algorithm> // std::max
+#include <algorithm> // std::max, std::fill
+#include <vector>    // std::vector
 
 // in house libraries
 #include <index/adapted/boolean/BooleanBitset.hpp>
@@ -18,6 +19,30 @@
 
 namespace rock{
 
+    /*
+    `CrustOpsScratch` is memory that is owned by the caller and reused by `CrustOps` across calls,
+    so that methods of `CrustOps` perform no heap allocations once the scratch has been constructed.
+    */
+    template <std::size_t M>
+    struct CrustOpsScratch
+    {
+        using bools = std::vector<bool>;
+
+        Formation<M> formation;
+        bools empty;
+        bools meta_empty;
+        bools newly_occupied;
+        bools empty_below;
+
+        explicit CrustOpsScratch(const std::size_t vertex_count):
+            formation(vertex_count),
+            empty(vertex_count),
+            meta_empty(vertex_count),
+            newly_occupied(vertex_count),
+            empty_below(vertex_count)
+        {}
+    };
+
     // NOTE: `M` is mineral count, `F` is formation count
     template <std::size_t M>
     class CrustOps
@@ -33,22 +58,12 @@ namespace rock{
         const iterated::Ternary ternary_;
         const iterated::Identity copy_;
 
-    public:
-        CrustOps():
-            ops(),
-            predicates(),
-            morphology(adapted::BooleanBitset{}),
-            ternary_(),
-            copy_()
-        {}
-
-        void absorb (const Crust<M,F>& top, const Crust<M,F>& bottom, Crust<M,F>& out, Formation<M>& scratch) const
-        {
+        void absorb (
+            const Crust<M,F>& top, const Crust<M,F>& bottom, Crust<M,F>& out,
+            Formation<M>& scratch, bools& empty, bools& meta_empty, bools& newly_occupied, bools& empty_below
+        ) const {
 
-            bools empty          (top[0].size());
-            bools meta_empty     (top[0].size());
-            bools newly_occupied (top[0].size());
-            bools empty_below    (top[0].size(), true);
+            std::fill(empty_below.begin(), empty_below.end(), true);
 
             copy_(top, out);
 
@@ -87,6 +102,34 @@ namespace rock{
 
         }
 
+    public:
+        CrustOps():
+            ops(),
+            predicates(),
+            morphology(adapted::BooleanBitset{}),
+            ternary_(),
+            copy_()
+        {}
+
+        /*
+        `absorb` deposits the formations of `bottom` beneath those of `top`.
+        This overload allocates its own boolean rasters on every call,
+        use the overload that accepts a `CrustOpsScratch` where this is called repeatedly.
+        */
+        void absorb (const Crust<M,F>& top, const Crust<M,F>& bottom, Crust<M,F>& out, Formation<M>& scratch) const
+        {
+            bools empty          (top[0].size());
+            bools meta_empty     (top[0].size());
+            bools newly_occupied (top[0].size());
+            bools empty_below    (top[0].size());
+            absorb(top, bottom, out, scratch, empty, meta_empty, newly_occupied, empty_below);
+        }
+
+        void absorb (const Crust<M,F>& top, const Crust<M,F>& bottom, Crust<M,F>& out, CrustOpsScratch<M>& scratch) const
+        {
+            absorb(top, bottom, out, scratch.formation, scratch.empty, scratch.meta_empty, scratch.newly_occupied, scratch.empty_below);
+        }
+
         // AKA, the identity function.
         void copy(const Crust<M,F>& crust, Crust<M,F>& out) const {
             for (std::size_t i = 0; i < out.size(); ++i)
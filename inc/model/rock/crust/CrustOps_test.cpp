@@ -185,3 +185,60 @@ TEST_CASE( "CrustOps::absorb() mass conservation", "[rock]" ) {
 
 }
 
+
+TEST_CASE( "CrustOps::absorb() scratch reuse", "[rock]" ) {
+
+    const int M = 2; // mineral count
+    const int F = 5; // formation count
+
+    using length = si::length<float>;
+    length meter(si::meter);
+    length radius(6.371e6f * meter);
+
+    int vertices_per_square_side(2);
+    dymaxion::Grid<int,int,float> grid(radius/meter, vertices_per_square_side);
+    rock::EarthlikeIgneousFormationGeneration generation(grid, radius/2.0f, 0.5f, 10);
+
+    iterated::Identity copy{};
+    rock::Formation<M> formation1(grid.vertex_count());
+    copy(generation(12.0f, 1.1e4f), formation1);
+
+    rock::Formation<M> formation2(grid.vertex_count());
+    copy(generation(22.0f, 1.2e4f), formation2);
+
+    rock::Formation<M> formation3(grid.vertex_count());
+    copy(generation(33.0f, 1.3e4f), formation3);
+
+    rock::StratumStore<M> empty_stratum;
+    rock::Formation<M> empty_formation(grid.vertex_count(), empty_stratum);
+    rock::Crust<M,F> empty_crust; empty_crust.fill(empty_formation);
+
+    rock::Crust<M,F> full{formation1, formation2, formation3, formation1, formation2};
+    rock::Crust<M,F> empty_igneous{formation3, formation1, formation2, empty_formation, empty_formation};
+    rock::Crust<M,F> empty_middle{formation2, formation3, empty_formation, formation1, formation3};
+
+    std::vector<rock::Crust<M,F>> crusts{empty_crust, full, empty_igneous, empty_middle};
+
+    rock::CrustOps<M> ops;
+    rock::CrustAdapter<M,F> testing(1e-4);
+
+    // a single scratch is reused across every call, so that results cannot depend on what a previous call left behind
+    rock::CrustOpsScratch<M> scratch(grid.vertex_count());
+    SECTION("absorb() must return the same result whether it is given a CrustOpsScratch or allocates its own"){
+        for (auto& a : crusts)
+        {
+            for (auto& b : crusts)
+            {
+                auto expected = empty_crust;
+                auto formation_scratch = empty_formation;
+                ops.absorb(a, b, expected, formation_scratch);
+
+                auto actual = empty_crust;
+                ops.absorb(a, b, actual, scratch);
+
+                CHECK(testing.equal(expected, actual));
+            }
+        }
+    }
+
+}
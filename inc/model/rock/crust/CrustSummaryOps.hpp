@@ -58,6 +58,7 @@ namespace rock{
             }
         }
 
+        template<typename CrustSummary, typename FormationSummary>
         void flatten (const CrustSummary& crust, FormationSummary& out) const
         {
             for (auto i = 0*out.size(); i < out.size(); ++i)
@@ -66,6 +67,7 @@ namespace rock{
             }
         }
 
+        template<typename CrustSummary>
         void empty(CrustSummary& out) const
         {
             const ColumnSummary empty;
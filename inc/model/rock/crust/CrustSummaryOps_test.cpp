@@ -13,6 +13,7 @@
 #include <model/rock/column/ColumnSummaryProperties.hpp>
 
 #include "CrustSummary.hpp"
+#include "CrustSummaryRasters.hpp"
 #include "CrustSummaryOps.hpp"
 #include "CrustSummaryProperties.hpp"
 
@@ -189,6 +190,73 @@ TEST_CASE( "CrustSummary absorb() mass conservation", "[rock]" ) {
     }
 }
 
+TEST_CASE( "CrustSummaryRasters layout agnosticism", "[rock]" ) {
+
+    using length = si::length<float>;
+    using density = si::density<float>;
+    using area_density = si::area_density<float>;
+
+    rock::CrustSummaryOps ops{
+        rock::ColumnSummaryOps{
+            length{si::centimeter}}};
+    rock::CrustSummaryAdapter inexact;
+
+    rock::StratumSummary strataless (std::bitset<8>(0), density(3000.0*si::kilogram/si::meter3), length(0.0*si::kilometer));
+    rock::StratumSummary subducting (std::bitset<8>(1), density(3300.0*si::kilogram/si::meter3), length( 5.0*si::kilometer));
+    rock::StratumSummary continental(std::bitset<8>(2), density(2700.0*si::kilogram/si::meter3), length( 7.0*si::kilometer));
+    rock::StratumSummary oceanic    (std::bitset<8>(4), density(3000.0*si::kilogram/si::meter3), length( 4.0*si::kilometer));
+
+    rock::CrustSummary a ({
+        rock::ColumnSummary(), 
+        rock::ColumnSummary(continental, strataless), 
+        rock::ColumnSummary(oceanic, strataless), 
+        rock::ColumnSummary(continental, oceanic), 
+        rock::ColumnSummary(continental, subducting), 
+        rock::ColumnSummary(oceanic, subducting)
+    });
+
+    rock::CrustSummaryRasters b(a);
+
+    SECTION("converting a CrustSummary to CrustSummaryRasters and back must reproduce the original") {
+        rock::CrustSummary a2(a.size());
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            a2[i] = b[i];
+        }
+        CHECK(inexact.equal(a, a2));
+    }
+
+    SECTION("flatten() must produce the same FormationSummary regardless of layout") {
+        rock::FormationSummary a_flat(a.size());
+        rock::FormationSummaryRasters b_flat(a.size());
+        rock::FormationSummary b_flat2(a.size());
+        ops.flatten(a, a_flat);
+        ops.flatten(b, b_flat);
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            b_flat2[i] = b_flat[i];
+        }
+        CHECK(rock::FormationSummaryAdapter().equal(a_flat, b_flat2));
+    }
+
+    SECTION("properties must produce the same raster regardless of layout") {
+        rock::CrustSummaryProperty crust_area_density(rock::ColumnSummaryAreaDensity{});
+        std::vector<area_density> a_density(a.size());
+        std::vector<area_density> b_density(a.size());
+        crust_area_density(a, a_density);
+        crust_area_density(b, b_density);
+        CHECK(a_density == b_density);
+    }
+
+    SECTION("setters on an element must only modify the field they set") {
+        b[1].top.thickness(length(9.0*si::kilometer));
+        CHECK(b[1].top.thickness() == length(9.0*si::kilometer));
+        CHECK(b[1].top.density() == continental.density());
+        CHECK(b[1].top.plate_ids_bitset() == continental.plate_ids_bitset());
+        CHECK(b[2].top.thickness() == oceanic.thickness());
+    }
+}
+
 /*
 test:
                 flatten
@@ -170,15 +170,18 @@ namespace rock {
         }
 
         /*
-        `rifting` returns a scalar raster indicating where gaps in the plates should be filled by a given plate
+        `rifting` returns a scalar raster indicating where gaps in the plates should be filled by a given plate.
+        Any `morphology_scratch` that is given is passed on to `Morphology`, 
+        e.g. a `unlayered::PackedMorphologyScratch` so that `unlayered::PackedMorphology` does not allocate.
         */
-        template<typename Grid>
+        template<typename Grid, typename... MorphologyScratch>
         void rifting(
             const Grid& grid,
             const bools& ownable,
             const bools& exists,
             bools& out,
-            bools& scratch
+            bools& scratch,
+            MorphologyScratch&... morphology_scratch
         ) const {
             /*
             The implementation below is equivalent to the following set logic:
@@ -186,15 +189,16 @@ namespace rock {
             */
             bools* will_stay_ownable = &scratch;
             bools* just_outside      = &out;
-            morphology.erode   (grid, ownable,      *will_stay_ownable);
-            morphology.outshell(grid, exists,       *just_outside);
+            morphology.erode   (grid, ownable,      *will_stay_ownable, morphology_scratch...);
+            morphology.outshell(grid, exists,       *just_outside,      morphology_scratch...);
             bitsets.intersect  (*will_stay_ownable, *just_outside, out);
         }
 
         /*
-        `detaching` returns a scalar raster indicating where cells of a plate should be destroyed
+        `detaching` returns a scalar raster indicating where cells of a plate should be destroyed.
+        Any `morphology_scratch` that is given is passed on to `Morphology`, as with `rifting`.
         */
-        template<typename Grid>
+        template<typename Grid, typename... MorphologyScratch>
         void detaching(
             const Grid& grid,
             const bools& accompanied,
@@ -202,12 +206,13 @@ namespace rock {
             const bools& foundering,
             const bools& exists,
             bools& out,
-            bools& scratch
+            bools& scratch,
+            MorphologyScratch&... morphology_scratch
         ) const {
             // bools* will_stay_accompanied = &scratch;
             bools* just_inside = &out;
             // morphology.erode   (grid, accompanied, *will_stay_accompanied);
-            morphology.inshell (grid, exists, *just_inside);
+            morphology.inshell (grid, exists, *just_inside, morphology_scratch...);
             bitsets.intersect  (accompanied, *just_inside, out);
             bitsets.intersect  (below, out, out);
             bitsets.intersect  (foundering, out, out);
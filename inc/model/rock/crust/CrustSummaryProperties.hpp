@@ -28,7 +28,7 @@ namespace rock {
         CrustSummaryProperty(const ColumnSummaryProperty& property):
             property(property)
         {}
-        void operator()(const CrustSummary& summary, auto& out) const
+        void operator()(const auto& summary, auto& out) const
         {
             for (auto i = 0*summary.size(); i < summary.size(); ++i)
             {
@@ -61,7 +61,7 @@ namespace rock {
         CrustSummaryMass()
         {}
 
-        template<typename Grid>
+        template<typename Grid, typename CrustSummary>
         void operator()(const Grid& grid, const CrustSummary& summary, masses& out) const
         {
             for (auto i = 0*summary.size(); i < summary.size(); ++i)
@@ -70,7 +70,7 @@ namespace rock {
             }
         }
 
-        template<typename Grid>
+        template<typename Grid, typename CrustSummary>
         mass operator()(const Grid& grid, const CrustSummary& summary) const
         {
             mass out(0);
@@ -0,0 +1,141 @@
+#pragma once
+
+// C libraries
+#include <cstddef> // std::size_t
+
+// std libraries
+#include <type_traits> // std::conditional_t, std::is_const_v
+
+// in house libraries
+#include <model/rock/column/ColumnSummary.hpp>
+#include <model/rock/formation/FormationSummaryRasters.hpp>
+
+namespace rock{
+
+    /*
+    `ColumnSummaryReference` refers to a single cell within a `CrustSummaryRasters`.
+    It offers the same members and accessors as `ColumnSummary`, see `StratumSummaryReference`.
+    */
+    template<typename Rasters>
+    struct ColumnSummaryReference
+    {
+        using Formation = std::conditional_t<std::is_const_v<Rasters>, const FormationSummaryRasters, FormationSummaryRasters>;
+
+        static constexpr bool is_mutable = !std::is_const_v<Rasters>;
+
+        StratumSummaryReference<Formation> top;
+        StratumSummaryReference<Formation> rest;
+
+        constexpr ColumnSummaryReference(Rasters& rasters, const std::size_t i):
+            top(rasters.top, i),
+            rest(rasters.rest, i)
+        {}
+
+        operator ColumnSummary() const
+        {
+            return ColumnSummary(StratumSummary(top), StratumSummary(rest));
+        }
+
+        ColumnSummaryReference& operator=(const ColumnSummary& summary) requires is_mutable
+        {
+            top = summary.top;
+            rest = summary.rest;
+            return *this;
+        }
+
+        ColumnSummaryReference& operator=(const ColumnSummaryReference& reference) requires is_mutable
+        {
+            return *this = ColumnSummary(reference);
+        }
+
+        [[nodiscard]] inline si::length<float> thickness() const
+        {
+            return top.thickness() + rest.thickness();
+        }
+
+        [[nodiscard]] inline si::area_density<float> area_density() const
+        {
+            return top.area_density() + rest.area_density();
+        }
+
+        [[nodiscard]] inline si::density<float> density() const
+        {
+            return area_density() / thickness();
+        }
+
+        [[nodiscard]] inline bool exists() const
+        {
+            return plate_count()>0;
+        }
+
+        [[nodiscard]] inline int plate_count() const
+        {
+            return top.plate_count() + rest.plate_count();
+        }
+
+        [[nodiscard]] inline bool includes(const int plate_id) const
+        {
+            return top.includes(plate_id) || rest.includes(plate_id);
+        }
+
+        [[nodiscard]] inline bool is_top(const int plate_id) const
+        {
+            return top.includes(plate_id);
+        }
+
+        [[nodiscard]] inline bool is_subducted(const int plate_id) const
+        {
+            return rest.includes(plate_id);
+        }
+
+    };
+
+    /*
+    `CrustSummaryRasters` stores the same information as a `CrustSummary`,
+    but with the `top` and `rest` of every column each stored as a `FormationSummaryRasters`.
+    See `FormationSummaryRasters` for motivation.
+    */
+    struct CrustSummaryRasters
+    {
+        FormationSummaryRasters top;
+        FormationSummaryRasters rest;
+
+        using value_type = ColumnSummary;
+        using reference = ColumnSummaryReference<CrustSummaryRasters>;
+        using const_reference = ColumnSummaryReference<const CrustSummaryRasters>;
+
+        explicit CrustSummaryRasters(const std::size_t size, const ColumnSummary& summary = ColumnSummary()):
+            top(size, summary.top),
+            rest(size, summary.rest)
+        {}
+
+        template<typename Summary>
+        requires requires(const Summary& summary) { summary.size(); summary[0]; }
+        explicit CrustSummaryRasters(const Summary& summary):
+            CrustSummaryRasters(summary.size())
+        {
+            for (std::size_t i = 0; i < summary.size(); ++i)
+            {
+                (*this)[i] = ColumnSummary(summary[i]);
+            }
+        }
+
+        inline std::size_t size() const
+        {
+            return top.size();
+        }
+
+        inline reference operator[](const std::size_t i)
+        {
+            return reference(*this, i);
+        }
+
+        inline const_reference operator[](const std::size_t i) const
+        {
+            return const_reference(*this, i);
+        }
+
+    };
+
+}
+
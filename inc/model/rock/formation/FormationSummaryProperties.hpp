@@ -23,7 +23,7 @@ namespace rock{
         FormationSummaryProperty(const StratumSummaryProperty& property):
             property(property)
         {}
-        void operator()(const FormationSummary& summary, auto& out) const
+        void operator()(const auto& summary, auto& out) const
         {
             for (auto i = 0*summary.size(); i < summary.size(); ++i)
             {
@@ -50,7 +50,7 @@ namespace rock{
         FormationSummaryMass()
         {}
 
-        template<typename Grid>
+        template<typename Grid, typename FormationSummary>
         void operator()(const Grid& grid, const FormationSummary& summary, masses& out) const
         {
             for (auto i = 0*summary.size(); i < summary.size(); ++i)
@@ -59,7 +59,7 @@ namespace rock{
             }
         }
 
-        template<typename Grid>
+        template<typename Grid, typename FormationSummary>
         mass operator()(const Grid& grid, const FormationSummary& summary) const
         {
             mass out(0);
@@ -0,0 +1,173 @@
+#pragma once
+
+// C libraries
+#include <cstddef> // std::size_t
+
+// std libraries
+#include <type_traits> // std::is_const_v
+#include <vector>      // std::vector
+
+// in-house libraries
+#include <unit/si.hpp>
+#include <model/rock/stratum/StratumSummary.hpp>
+
+namespace rock
+{
+
+    /*
+    `StratumSummaryReference` refers to a single cell within a `FormationSummaryRasters`.
+    It offers the same accessors as `StratumSummary`, so that code written as `summary[i].thickness()`
+    is agnostic to whether `summary` is a `FormationSummary` or a `FormationSummaryRasters`.
+    Only the fields that are accessed are ever read from memory.
+    `Rasters` is either `FormationSummaryRasters` or `const FormationSummaryRasters`,
+    and setters are only available in the former case.
+    */
+    template<typename Rasters>
+    class StratumSummaryReference
+    {
+        using uint = unsigned int;
+
+        static constexpr si::density<float> kilogram_per_meter3 = si::density<float>(si::kilogram/si::meter3);
+        static constexpr si::length<float> meter = si::length<float>(si::meter);
+
+        static constexpr bool is_mutable = !std::is_const_v<Rasters>;
+
+        Rasters& rasters;
+        const std::size_t i;
+
+    public:
+
+        constexpr StratumSummaryReference(Rasters& rasters, const std::size_t i):
+            rasters(rasters),
+            i(i)
+        {}
+
+        operator StratumSummary() const
+        {
+            StratumSummary result;
+            result.thickness_in_meters = rasters.thicknesses_in_meters[i];
+            result.density_in_kilograms_per_meter3 = rasters.densities_in_kilograms_per_meter3[i];
+            result.plate_ids_bitset_ = rasters.plate_ids_bitsets[i];
+            return result;
+        }
+
+        StratumSummaryReference& operator=(const StratumSummary& summary) requires is_mutable
+        {
+            rasters.thicknesses_in_meters[i] = summary.thickness_in_meters;
+            rasters.densities_in_kilograms_per_meter3[i] = summary.density_in_kilograms_per_meter3;
+            rasters.plate_ids_bitsets[i] = summary.plate_ids_bitset_;
+            return *this;
+        }
+
+        StratumSummaryReference& operator=(const StratumSummaryReference& reference) requires is_mutable
+        {
+            return *this = StratumSummary(reference);
+        }
+
+        [[nodiscard]] si::density<float> density() const
+        {
+            return rasters.densities_in_kilograms_per_meter3[i] * kilogram_per_meter3;
+        }
+        void density(const si::density<float> density) requires is_mutable
+        {
+            rasters.densities_in_kilograms_per_meter3[i] = (uint(density/kilogram_per_meter3));
+        }
+
+        [[nodiscard]] si::length<float> thickness() const
+        {
+            return rasters.thicknesses_in_meters[i] * meter;
+        }
+        void thickness(const si::length<float> thickness) requires is_mutable
+        {
+            rasters.thicknesses_in_meters[i] = thickness/meter;
+        }
+
+        [[nodiscard]] PlateIds plate_ids_bitset() const
+        {
+            return rasters.plate_ids_bitsets[i];
+        }
+        void plate_ids_bitset(const PlateIds value) requires is_mutable
+        {
+            rasters.plate_ids_bitsets[i] = value;
+        }
+
+        [[nodiscard]] si::area_density<float> area_density() const
+        {
+            return density() * thickness();
+        }
+
+        [[nodiscard]] int largest_plate_id() const
+        {
+            return plate_ids_bitset().largest();
+        }
+
+        [[nodiscard]] int plate_count() const
+        {
+            return plate_ids_bitset().count();
+        }
+
+        [[nodiscard]] bool includes(const int plate_id) const
+        {
+            return plate_ids_bitset().test(plate_id);
+        }
+
+    };
+
+    /*
+    `FormationSummaryRasters` stores the same information as a `FormationSummary`,
+    but as one raster per field ("structure of arrays") rather than a raster of `StratumSummary` ("array of structs").
+    Passes that only read one or two fields (e.g. thickness and density for buoyancy)
+    then stream through contiguous memory and can be vectorized by the compiler.
+    Elements are accessed by index as with `FormationSummary`, see `StratumSummaryReference`.
+    */
+    struct FormationSummaryRasters
+    {
+        std::vector<float> thicknesses_in_meters;
+        std::vector<unsigned int> densities_in_kilograms_per_meter3;
+        std::vector<PlateIds> plate_ids_bitsets;
+
+        using value_type = StratumSummary;
+        using reference = StratumSummaryReference<FormationSummaryRasters>;
+        using const_reference = StratumSummaryReference<const FormationSummaryRasters>;
+
+        explicit FormationSummaryRasters(const std::size_t size, const StratumSummary& summary = StratumSummary()):
+            thicknesses_in_meters(size),
+            densities_in_kilograms_per_meter3(size),
+            plate_ids_bitsets(size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                (*this)[i] = summary;
+            }
+        }
+
+        template<typename Summary>
+        requires requires(const Summary& summary) { summary.size(); summary[0]; }
+        explicit FormationSummaryRasters(const Summary& summary):
+            FormationSummaryRasters(summary.size())
+        {
+            for (std::size_t i = 0; i < summary.size(); ++i)
+            {
+                (*this)[i] = StratumSummary(summary[i]);
+            }
+        }
+
+        inline std::size_t size() const
+        {
+            return thicknesses_in_meters.size();
+        }
+
+        inline reference operator[](const std::size_t i)
+        {
+            return reference(*this, i);
+        }
+
+        inline const_reference operator[](const std::size_t i) const
+        {
+            return const_reference(*this, i);
+        }
+
+    };
+
+}
+
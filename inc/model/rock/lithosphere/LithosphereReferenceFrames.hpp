@@ -82,6 +82,38 @@ namespace rock{
             }
         }
 
+        /*
+        The following overloads resample using the ids stored in a `LithosphereResamplingPlan`,
+        which avoids finding nearest vertices every time rasters are resampled.
+        The plan must be updated with the rotations of the current frame before calling these methods.
+        */
+
+        template<typename Plan, typename Raster>
+        void globalize(
+            const Plan& plan,
+            const std::vector<Raster>& locals,
+            std::vector<Raster>& globals
+        ) const {
+            #pragma omp parallel for
+            for (std::size_t i = 0; i < plan.globalize_ids.size(); ++i)
+            {
+                index(locals[i], plan.globalize_ids[i], globals[i]);
+            }
+        }
+
+        template<typename Plan, typename Raster>
+        void localize(
+            const Plan& plan,
+            const Raster& global,
+            std::vector<Raster>& locals
+        ) const {
+            #pragma omp parallel for
+            for (std::size_t i = 0; i < plan.localize_ids.size(); ++i)
+            {
+                index(global, plan.localize_ids[i], locals[i]);
+            }
+        }
+
     };
 
     /*
@@ -90,6 +122,12 @@ namespace rock{
     frames       .globalize (rotations, locals, globals)     // resample plate-specific rasters onto a global grid
     summarization.flatten   (globals,   master)              // flatten globalized rasters into (e.g.) a LithosphereSummary
     frames       .localize  (rotations, master, derivatives) // resample global raster to a plate-specific for each plate
+
+    use case where rotations change little between frames:
+    plan         .update    (rotations)                      // find ids to resample, reusing previous ids where possible
+    frames       .globalize (plan,      locals, globals)
+    summarization.flatten   (globals,   master)
+    frames       .localize  (plan,      master, derivatives)
     */
 
     template<typename id, typename scalar, typename mat, 
@@ -0,0 +1,185 @@
+#pragma once
+
+// C libraries
+#include <cstddef>   // std::size_t
+#include <cmath>     // std::sqrt
+
+// std libraries
+#include <vector>    // std::vector
+#include <initializer_list> // std::initializer_list
+
+// 3rd party libraries
+#include <glm/geometric.hpp> // glm::dot
+
+namespace rock{
+
+    /*
+    `LithosphereResamplingPlan` stores the ids that are gathered by `LithosphereReferenceFrames`
+    when resampling rasters between the reference frames of plates and the global reference frame.
+
+    For each plate `i` and each vertex `j` of the grid, the plan stores:
+    * `globalize_ids[i][j]` the id of the vertex on plate `i` that is nearest to global vertex `j`
+    * `localize_ids[i][j]`  the id of the global vertex that is nearest to vertex `j` of plate `i`
+
+    Finding these ids with `Grid::nearest_vertex_id` requires a matrix multiply and a projection for every vertex,
+    and it is the dominant cost of `globalize` and `localize` when done every frame.
+    Since plates rotate very little between frames, `update` instead does the following for each plate:
+    * if the rotation has changed by less than `reuse_threshold`, the ids are left as they are
+    * if the rotation has changed by less than `walk_threshold`, each id is found by walking across neighbors,
+      starting from its previous value, until no neighbor is closer to the desired position
+    * otherwise, each id is found using `Grid::nearest_vertex_id`
+
+    `positions` is read out of order while walking, so it is faster if `positions` is a cache.
+    `grid` and `positions` are stored by reference, so they must outlive the plan.
+
+    The change in rotation is measured as the Frobenius norm of the difference between the old and new matrices,
+    which is an upper bound on the distance that any point on the unit sphere can move.
+    Thresholds are therefore expressed as fractions of the grid radius.
+
+    A walk stops at a vertex that is nearer to the desired position than any of its neighbors, 
+    which in practice is the vertex that is truly nearest.
+    `nearest_vertex_id` only approximates the nearest vertex by rounding projected coordinates,
+    so a walk and a projection can disagree by one cell for positions that lie near the boundary between cells.
+    */
+    template<typename id, typename scalar, typename mat, typename Grid, typename VertexPositions>
+    class LithosphereResamplingPlan
+    {
+
+        const Grid& grid;
+        const VertexPositions& positions;
+        const scalar reuse_threshold;
+        const scalar walk_threshold;
+
+        static scalar distance(const mat& a, const mat& b)
+        {
+            scalar sum(0);
+            for (int i = 0; i < mat::length(); ++i)
+            {
+                const auto difference = a[i] - b[i];
+                sum += glm::dot(difference, difference);
+            }
+            return std::sqrt(sum);
+        }
+
+        /*
+        `walk` returns the id of the vertex nearest to `position` that can be found by
+        repeatedly moving to the neighbor that is nearest to `position`, starting from `start`.
+        Diagonal neighbors are considered as well, since cells near the corners of a square are sheared
+        to the extent that a diagonal neighbor can be nearer than any of the four neighbors that share an arrow.
+        Nearness is measured using the dot product since all vertices lie on a sphere.
+        */
+        template<typename vec3>
+        id walk(const vec3 position, const id start) const
+        {
+            const id N = grid.arrows_per_vertex;
+            id current = start;
+            auto current_dot = glm::dot(positions[current], position);
+            bool moved = true;
+            while (moved)
+            {
+                moved = false;
+                const id origin = current;
+                for (id j = 0; j < N; ++j)
+                {
+                    const id neighbor = grid.arrow_target_id(origin, j);
+                    const id diagonal = grid.arrow_target_id(neighbor, (j+1)%N);
+                    for (const id candidate : {neighbor, diagonal})
+                    {
+                        const auto candidate_dot = glm::dot(positions[candidate], position);
+                        if (candidate_dot > current_dot)
+                        {
+                            current = candidate;
+                            current_dot = candidate_dot;
+                            moved = true;
+                        }
+                    }
+                }
+            }
+            return current;
+        }
+
+        /*
+        `gather` sets `ids[j]` to the id of the vertex that is nearest to the position of vertex `j`
+        after it has been transformed by `transform`.
+        */
+        void gather(const mat& transform, const bool is_walk, std::vector<id>& ids) const
+        {
+            const std::size_t vertex_count = grid.vertex_count();
+            ids.resize(vertex_count);
+            #ifdef _OPENMP
+            #pragma omp parallel for
+            #endif
+            for (std::size_t j = 0; j < vertex_count; ++j)
+            {
+                const auto position = transform * positions[j];
+                ids[j] = is_walk? walk(position, ids[j]) : id(grid.nearest_vertex_id(position));
+            }
+        }
+
+    public:
+
+        std::vector<mat> locals_to_globals;
+        std::vector<std::vector<id>> globalize_ids;
+        std::vector<std::vector<id>> localize_ids;
+
+        LithosphereResamplingPlan(const Grid& grid, const VertexPositions& positions, 
+            const scalar reuse_threshold, const scalar walk_threshold
+        ):
+            grid(grid),
+            positions(positions),
+            reuse_threshold(reuse_threshold),
+            walk_threshold(walk_threshold),
+            locals_to_globals(),
+            globalize_ids(),
+            localize_ids()
+        {}
+
+        /*
+        `update` brings the plan up to date with the rotations given by `locals_to_globals`.
+        Plates that are not yet known to the plan are always found using `nearest_vertex_id`.
+        */
+        void update(const std::vector<mat>& locals_to_globals_)
+        {
+            const std::size_t plate_count = locals_to_globals_.size();
+            globalize_ids.resize(plate_count);
+            localize_ids.resize(plate_count);
+            for (std::size_t i = 0; i < plate_count; ++i)
+            {
+                const bool is_known = i < locals_to_globals.size();
+                const scalar change = is_known? distance(locals_to_globals_[i], locals_to_globals[i]) : scalar(0);
+                if (is_known && change < reuse_threshold)
+                {
+                    continue;
+                }
+                const bool is_walk = is_known && change < walk_threshold;
+                /*
+                            grid      rotation    grid
+                resample = id ⟶ position ⟶ position ⟶ id
+                */
+                gather(glm::transpose(locals_to_globals_[i]), is_walk, globalize_ids[i]);
+                gather(locals_to_globals_[i],                 is_walk, localize_ids[i]);
+                if (is_known)
+                {
+                    locals_to_globals[i] = locals_to_globals_[i];
+                }
+                else
+                {
+                    locals_to_globals.push_back(locals_to_globals_[i]);
+                }
+            }
+            locals_to_globals.resize(plate_count);
+        }
+
+    };
+
+    template<typename id, typename scalar, typename mat, typename Grid, typename VertexPositions>
+    auto lithosphere_resampling_plan(const Grid& grid, const VertexPositions& positions, 
+        const scalar reuse_threshold, const scalar walk_threshold
+    ) {
+        return LithosphereResamplingPlan<id,scalar,mat,Grid,VertexPositions>(
+            grid, positions, reuse_threshold, walk_threshold
+        );
+    }
+
+}
+
@@ -0,0 +1,85 @@
+// std libraries
+#include <algorithm> // std::max
+#include <vector>    // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch/catch.hpp>
+
+#include <glm/vec3.hpp>                  // *vec3
+#include <glm/mat3x3.hpp>                // *mat3
+#include <glm/geometric.hpp>             // glm::dot
+#include <glm/gtc/matrix_transform.hpp>  // glm::rotate
+
+// in house libraries
+#include <grid/dymaxion/Grid.hpp>      // dymaxion::Grid
+#include <grid/dymaxion/GridCache.hpp> // dymaxion::GridCache
+
+#include "LithosphereResamplingPlan.hpp"
+
+namespace {
+
+    /*
+    `mismatch_count` returns the number of vertices `j` for which `ids[j]` is not the vertex 
+    that a brute force search finds to be nearest to the position of vertex `j` after it is transformed by `transform`,
+    where ties are resolved by accepting either vertex
+    */
+    template<typename Grid, typename mat>
+    int mismatch_count(const Grid& grid, const mat& transform, const std::vector<int>& ids)
+    {
+        int count(0);
+        for (int j = 0; j < grid.vertex_count(); ++j)
+        {
+            const auto position = transform * grid.vertex_positions[j];
+            double nearest_dot(glm::dot(grid.vertex_positions[0], position));
+            for (int k = 1; k < grid.vertex_count(); ++k)
+            {
+                nearest_dot = std::max(nearest_dot, glm::dot(grid.vertex_positions[k], position));
+            }
+            count += glm::dot(grid.vertex_positions[ids[j]], position) < nearest_dot - 1e-12;
+        }
+        return count;
+    }
+
+}
+
+TEST_CASE( "LithosphereResamplingPlan::update()", "[rock]" ) {
+
+    using mat3 = glm::dmat3;
+    using vec3 = glm::dvec3;
+
+    dymaxion::Grid<int,int,double> grid(1.0, 10);
+    dymaxion::GridCache<int,int,double> cache(grid);
+
+    auto rotation = [](const double angle, const vec3 axis){
+        return mat3(glm::rotate(glm::dmat4(1.0), angle, axis));
+    };
+
+    SECTION("LithosphereResamplingPlan.update() must find the same nearest vertices as a brute force search while walking"){
+        // rotations below the walk threshold are walked from the ids of the previous frame
+        auto plan = rock::lithosphere_resampling_plan<int,double,mat3>(cache, cache.vertex_positions, 1e-9, 1.0);
+        plan.update({mat3(1.0), rotation(0.3, vec3(1,2,3))});
+        for (int frame = 1; frame <= 5; ++frame)
+        {
+            const std::vector<mat3> locals_to_globals{
+                rotation(0.05*frame, vec3(0,0,1)), 
+                rotation(0.3 + 0.04*frame, vec3(1,2,3))
+            };
+            plan.update(locals_to_globals);
+            for (std::size_t i = 0; i < locals_to_globals.size(); ++i)
+            {
+                CHECK(mismatch_count(cache, glm::transpose(locals_to_globals[i]), plan.globalize_ids[i]) == 0);
+                CHECK(mismatch_count(cache, locals_to_globals[i], plan.localize_ids[i]) == 0);
+            }
+        }
+    }
+
+    SECTION("LithosphereResamplingPlan.update() must leave ids unchanged if rotations change less than the reuse threshold"){
+        auto plan = rock::lithosphere_resampling_plan<int,double,mat3>(cache, cache.vertex_positions, 1e-3, 1.0);
+        plan.update({rotation(0.3, vec3(1,2,3))});
+        const std::vector<int> globalize_ids(plan.globalize_ids[0]);
+        plan.update({rotation(0.3 + 1e-5, vec3(1,2,3))});
+        CHECK(plan.globalize_ids[0] == globalize_ids);
+    }
+
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+// C libraries
+#include <cassert> // assert
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+
+// std libraries
+#include <bit>     // std::popcount, std::bit_width
+#include <bitset>  // std::bitset
+#include <limits>  // std::numeric_limits
+#include <string>  // std::string
+
+namespace rock{
+
+    /*
+    `PlateIdBitset` is the set of plates that contribute to a `StratumSummary`.
+    It offers the subset of the `std::bitset` interface that is used by the rock model,
+    but stores its bits in a single unsigned integer, `Mask`,
+    so that the maximum plate count is `std::numeric_limits<Mask>::digits`
+    and membership tests, unions, and counts compile down to single bitwise or popcount instructions.
+    Unlike `std::bitset`, its footprint is exactly that of `Mask`,
+    so e.g. a 32 bit mask lets `StratumSummary` shrink rather than grow.
+    */
+    template<typename Mask>
+    class PlateIdBitset
+    {
+        static_assert(std::numeric_limits<Mask>::is_integer && !std::numeric_limits<Mask>::is_signed);
+
+        Mask mask;
+
+    public:
+
+        static constexpr std::size_t max_plate_count = std::numeric_limits<Mask>::digits;
+
+        constexpr PlateIdBitset():
+            mask(0)
+        {}
+
+        constexpr PlateIdBitset(const unsigned long long mask):
+            mask(Mask(mask))
+        {}
+
+        // allows a `std::bitset` to be used where a `PlateIdBitset` is expected, as was the case before `PlateIdBitset` existed
+        template<std::size_t N>
+        constexpr PlateIdBitset(const std::bitset<N>& bitset):
+            mask(Mask(bitset.to_ullong()))
+        {}
+
+        static constexpr PlateIdBitset single(const int plate_id)
+        {
+            assert(0 <= plate_id && plate_id < int(max_plate_count));
+            return PlateIdBitset(Mask(Mask(1) << plate_id));
+        }
+
+        static constexpr std::size_t size()
+        {
+            return max_plate_count;
+        }
+
+        [[nodiscard]] constexpr bool test(const int plate_id) const
+        {
+            assert(0 <= plate_id && plate_id < int(max_plate_count));
+            return (mask >> plate_id) & Mask(1);
+        }
+
+        constexpr PlateIdBitset& set(const int plate_id)
+        {
+            assert(0 <= plate_id && plate_id < int(max_plate_count));
+            mask |= Mask(Mask(1) << plate_id);
+            return *this;
+        }
+
+        [[nodiscard]] constexpr int count() const
+        {
+            return std::popcount(mask);
+        }
+
+        [[nodiscard]] constexpr bool any() const
+        {
+            return mask != 0;
+        }
+
+        [[nodiscard]] constexpr bool none() const
+        {
+            return mask == 0;
+        }
+
+        // returns -1 if the set is empty
+        [[nodiscard]] constexpr int largest() const
+        {
+            return int(std::bit_width(mask)) - 1;
+        }
+
+        [[nodiscard]] constexpr unsigned long to_ulong() const
+        {
+            return (unsigned long)(mask);
+        }
+
+        [[nodiscard]] constexpr unsigned long long to_ullong() const
+        {
+            return (unsigned long long)(mask);
+        }
+
+        [[nodiscard]] std::string to_string() const
+        {
+            return std::bitset<max_plate_count>(to_ullong()).to_string();
+        }
+
+        constexpr PlateIdBitset operator|(const PlateIdBitset other) const
+        {
+            return PlateIdBitset(Mask(mask | other.mask));
+        }
+
+        constexpr PlateIdBitset operator&(const PlateIdBitset other) const
+        {
+            return PlateIdBitset(Mask(mask & other.mask));
+        }
+
+        constexpr bool operator==(const PlateIdBitset other) const
+        {
+            return mask == other.mask;
+        }
+
+    };
+
+    using PlateIdBitset8  = PlateIdBitset<std::uint8_t>;
+    using PlateIdBitset16 = PlateIdBitset<std::uint16_t>;
+    using PlateIdBitset32 = PlateIdBitset<std::uint32_t>;
+    using PlateIdBitset64 = PlateIdBitset<std::uint64_t>;
+
+}
+
@@ -3,7 +3,6 @@
 // C libraries
 
 // std libraries
-#include <bitset>
 #include <limits>
 
 // 3rd party libraries
@@ -39,7 +38,7 @@ namespace rock
         StratumSummary operator() (const int plate_id, const si::area<float> area, const StratumStore<M>& stratum) const
         {
             auto mass = stratum.mass();
-            auto plate_id_bitset = mass > mass_threshold? std::bitset<8>(1<<plate_id) : std::bitset<8>(0);
+            auto plate_id_bitset = mass > mass_threshold? PlateIds::single(plate_id) : PlateIds();
             auto density = mass > mass_threshold? density_for_stratum(stratum) : si::density<float>(oo*si::kilogram/si::meter3);
             return StratumSummary(plate_id_bitset, density, mass/(area*density));
         }
@@ -4,15 +4,31 @@
 #include <cmath> // std::max
 
 // std libraries
-#include <bitset>
+#include <cstdint> // std::uint64_t
 
 // in house libraries
 #include <unit/si.hpp>
 
+#include "PlateIdBitset.hpp"
+
+/*
+`ROCK_PLATE_ID_MASK` is the unsigned integer type that stores the plates of a `StratumSummary`,
+and so determines the maximum plate count of a simulation, see `PlateIdBitset`.
+*/
+#ifndef ROCK_PLATE_ID_MASK
+#define ROCK_PLATE_ID_MASK std::uint64_t
+#endif
+
 namespace rock{
 
+    using PlateIds = PlateIdBitset<ROCK_PLATE_ID_MASK>;
+
+    template<typename Rasters> class StratumSummaryReference;
+
     class StratumSummary
     {
+        template<typename Rasters> friend class StratumSummaryReference;
+
         using uint = unsigned int;
 
         static constexpr si::density<float> kilogram_per_meter3 = si::density<float>(si::kilogram/si::meter3);
@@ -21,7 +37,7 @@ namespace rock{
 
         float thickness_in_meters;
         unsigned int density_in_kilograms_per_meter3;
-        std::bitset<8> plate_ids_bitset_; 
+        PlateIds plate_ids_bitset_;
     public:
 
         // identity under combination
@@ -32,7 +48,7 @@ namespace rock{
         {}
 
         constexpr StratumSummary(
-            const std::bitset<8> plate_ids_bitset,
+            const PlateIds plate_ids_bitset,
             const si::density<float> density,
             const si::length<float>  thickness
         ):
@@ -67,11 +83,11 @@ namespace rock{
             thickness_in_meters = thickness/meter;
         }
 
-        [[nodiscard]] std::bitset<8> plate_ids_bitset() const
+        [[nodiscard]] PlateIds plate_ids_bitset() const
         {
             return plate_ids_bitset_;
         }
-        void plate_ids_bitset(const std::bitset<8> value)
+        void plate_ids_bitset(const PlateIds value)
         {
             plate_ids_bitset_ = value;
         }
@@ -84,7 +100,7 @@ namespace rock{
 
         [[nodiscard]] int largest_plate_id() const
         {
-            return int(std::log2(float(plate_ids_bitset_.to_ulong())));
+            return plate_ids_bitset_.largest();
         }
 
         [[nodiscard]] int plate_count() const
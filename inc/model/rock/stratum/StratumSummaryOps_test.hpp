@@ -66,3 +66,24 @@ TEST_CASE( "StratumSummary combine() mass conservation", "[rock]" ) {
     }
 }
 
+
+TEST_CASE( "StratumSummary combine() plate ids beyond 8 plates", "[rock]" ) {
+
+    using density = si::density<float>;
+    using length = si::length<float>;
+
+    rock::StratumSummaryOps tools;
+
+    const int plate_id = rock::PlateIds::max_plate_count-1;
+    rock::StratumSummary a(rock::PlateIds::single(3),        density(3000.0*si::kilogram/si::meter3), length(4.0*si::kilometer));
+    rock::StratumSummary b(rock::PlateIds::single(plate_id), density(3300.0*si::kilogram/si::meter3), length(5.0*si::kilometer));
+    rock::StratumSummary ab = tools.combine(a, b);
+
+    SECTION("combine() must preserve membership of every plate that the mask can represent"){
+        CHECK(ab.includes(3));
+        CHECK(ab.includes(plate_id));
+        CHECK(!ab.includes(4));
+        CHECK(ab.plate_count() == 2);
+        CHECK(ab.largest_plate_id() == plate_id);
+    }
+}
@@ -14,7 +14,7 @@ namespace rock{
         ):
             mantle_density(mantle_density)
         {}
-        si::length<float> operator()(const StratumSummary& summary) const 
+        si::length<float> operator()(const auto& summary) const 
         {
             return summary.thickness() * (1.0f - summary.density()/mantle_density);
         }
@@ -38,7 +38,7 @@ namespace rock{
             gravity(gravity),
             mantle_density(mantle_density)
         {}
-        auto operator()(const StratumSummary& summary) const
+        auto operator()(const auto& summary) const
         {
             auto density_difference = si::max(
                 0.0*si::kilogram/si::meter3, 
@@ -55,7 +55,7 @@ namespace rock{
     {
         StratumSummaryThickness()
         {}
-        auto operator()(const StratumSummary& summary) const
+        auto operator()(const auto& summary) const
         {
             return summary.thickness();
         }
@@ -65,7 +65,7 @@ namespace rock{
     {
         StratumSummaryDensity()
         {}
-        auto operator()(const StratumSummary& summary) const
+        auto operator()(const auto& summary) const
         {
             return summary.density();
         }
@@ -75,7 +75,7 @@ namespace rock{
     {
         StratumSummaryAreaDensity()
         {}
-        auto operator()(const StratumSummary& summary) const
+        auto operator()(const auto& summary) const
         {
             return summary.area_density();
         }
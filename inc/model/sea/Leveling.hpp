@@ -7,7 +7,8 @@
 #include <index/adapted/symbolic/SymbolicArithmetic.hpp>
 #include <index/adapted/symbolic/SymbolicOrder.hpp>
 #include <index/iterated/Arithmetic.hpp>
-#include <index/iterated/Order.hpp>
+#include <index/lazy/Arithmetic.hpp>
+#include <index/lazy/Order.hpp>
 #include <index/aggregated/Order.hpp>
 #include <index/aggregated/Reduction.hpp>
 #include <index/binned/Statistics.hpp>
@@ -34,9 +35,9 @@ namespace sea
         using lengths = std::vector<length>;
         using scalars = std::vector<scalar>;
 
-        // const iterated::Arithmetic<adapted::SymbolicArithmetic> arithmetic;
         const aggregated::Order<adapted::SymbolicOrder> order;
-        const iterated::Order<adapted::SymbolicOrder> orders;
+        const lazy::Arithmetic<adapted::SymbolicArithmetic> arithmetic;
+        const lazy::Order<adapted::SymbolicOrder> orders;
         // const binned::Statistics<aggregated::Order<adapted::SymbolicOrder>, adapted::SymbolicArithmetic> binning;
         // const preceded::Statistics<adapted::SymbolicArithmetic> preceding;
         const aggregated::Reduction<adapted::SymbolicArithmetic> total;
@@ -50,8 +51,8 @@ namespace sea
             const length unit_length,
             const scalar epsilon
         ):
-            // arithmetic(),
             order(),
+            arithmetic(),
             orders(),
             // binning(),
             // preceding(),
@@ -82,18 +83,16 @@ namespace sea
             const length min_displacement
         ) const {
             /*
-            We use a regular for loop instead of functionality under `index/` 
-            since the alternative requires storing to multiple temporary rasters.
+            We use expressions under `lazy::` so that the volume is found in a single loop, 
+            without storing to temporary rasters.
             */
             auto zero = scalar(0)*unit_length*unit_length*unit_length;
-            auto out = zero;
-            auto column = zero;
-            for (unsigned int i = 0; i < displacement.size(); ++i)
-            {
-                column = (max_sea_depth - (displacement[i]-min_displacement)) * vertex_areas[i];
-                out += column > zero? column : zero;
-            }
-            return out;
+            auto columns = arithmetic.multiply(
+                arithmetic.subtract(
+                    procedural::uniform(max_sea_depth), 
+                    arithmetic.subtract(displacement, procedural::uniform(min_displacement))),
+                vertex_areas);
+            return total.sum(orders.max(columns, procedural::uniform(zero)), zero);
         }
 
 
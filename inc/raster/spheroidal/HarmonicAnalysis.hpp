@@ -21,7 +21,7 @@ namespace spheroidal
 
         constexpr int coefficient_id(const int M, const int L) const
         {
-            return (L-1)*(L-1) + M+L;
+            return L*L + M+L;
         }
 
 		const Positions positions;
@@ -56,7 +56,7 @@ namespace spheroidal
 		) const {
 			if constexpr(L>=0)
 			{
-				// decompose_degrees<L-1>(scalar, z, phi, fractional_area, inout);
+				decompose_degrees<L-1>(scalar, z, phi, fractional_area, inout);
 				decompose_orders<L,L>(scalar, z, phi, fractional_area, inout);
 			}
 		}
@@ -0,0 +1,182 @@
+#pragma once
+
+// C libraries
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+
+// std libraries
+#include <algorithm> // std::min
+#include <vector>    // std::vector
+
+// 3rd party libraries
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include <field/harmonics/AssociatedLegendreRecurrence.hpp>
+#include <field/harmonics/AzimuthRecurrence.hpp>
+#include <field/harmonics/HarmonicSeries.hpp>
+
+namespace spheroidal
+{
+
+	/*
+	`spheroidal::HarmonicTransform<T>` maps between harmonic and spatial domains on a spheroidal object
+	in the same way as `spheroidal::HarmonicAnalysis`, but for a degree `Lhi` that is chosen at runtime,
+	and at a cost that permits degrees in the hundreds.
+	Coefficients are stored in a flat array that is indexed by `coefficient_id(M,L)`, like that of `field::SphericalHarmonics`.
+
+	For each cell, every Pₗₘ is found in a single sweep by `field::AssociatedLegendreRecurrence`,
+	and cos(mϕ) and sin(mϕ) are found for each order by angle addition from cos(ϕ) and sin(ϕ),
+	so that cells require neither `atan2` nor any trigonometric function besides.
+	Cells are distributed across OpenMP threads when compiled with `-fopenmp`.
+	`decompose` sums the contributions of a fixed number of chunks of cells in order,
+	so results do not depend on the number of threads.
+
+	The cost of either `decompose` or `compose` is roughly 3(Lhi+1)²/2 multiply-adds per cell.
+	*/
+	template <typename T>
+	class HarmonicTransform
+	{
+
+		static constexpr std::ptrdiff_t chunk_count = 64;
+
+		field::AssociatedLegendreRecurrence<T> legendre;
+		std::vector<T> zs;
+		std::vector<T> cos_phis;
+		std::vector<T> sin_phis;
+		std::vector<T> fractional_areas;
+
+		/*
+		`accumulate` adds f Yₗₘ to each coefficient of `inout` for a given cell,
+		using `legendre_values` to store Pₗₘ
+		*/
+		void accumulate(
+			const std::size_t cell,
+			const T f,
+			std::vector<T>& legendre_values,
+			std::vector<T>& inout
+		) const {
+			legendre(zs[cell], legendre_values);
+			field::accumulate_harmonics(legendre, legendre_values, field::AzimuthRecurrence<T>(cos_phis[cell], sin_phis[cell]), f, inout);
+		}
+
+	public:
+
+		using value_type = T;
+
+		template <typename Positions, typename Areas>
+		HarmonicTransform(
+			const Positions& positions,
+			const Areas& areas,
+			const int Lhi
+		):
+			legendre(Lhi),
+			zs(positions.size()),
+			cos_phis(positions.size()),
+			sin_phis(positions.size()),
+			fractional_areas(positions.size())
+		{
+			T total_area(0);
+			for (std::size_t i = 0; i < areas.size(); ++i)
+			{
+				total_area += areas[i];
+			}
+			for (std::size_t i = 0; i < positions.size(); ++i)
+			{
+				const auto u(glm::normalize(positions[i]));
+				zs[i] = u.z;
+				field::azimuth(u, cos_phis[i], sin_phis[i]);
+				fractional_areas[i] = areas[i] / total_area;
+			}
+		}
+
+		inline int degree() const
+		{
+			return legendre.Lhi;
+		}
+
+		inline int coefficient_count() const
+		{
+			return (legendre.Lhi+1)*(legendre.Lhi+1);
+		}
+
+		static constexpr inline int coefficient_id(const int M, const int L)
+		{
+			return field::harmonic_coefficient_id(M,L);
+		}
+
+		/*
+		`decompose` stores in `coefficients` the coefficient of each spherical harmonic for `raster`,
+		where `coefficients` must be able to store `coefficient_count()` values
+		*/
+		template<typename Raster, typename Coefficients>
+		void decompose(const Raster& raster, Coefficients& coefficients) const
+		{
+			const std::ptrdiff_t cell_count(zs.size());
+			const std::ptrdiff_t chunk_size((cell_count + chunk_count - 1) / chunk_count);
+			std::vector<std::vector<T>> chunk_coefficients(chunk_count, std::vector<T>(coefficient_count(), T(0)));
+			#ifdef _OPENMP
+			#pragma omp parallel
+			#endif
+			{
+				std::vector<T> legendre_values(legendre.size());
+				#ifdef _OPENMP
+				#pragma omp for schedule(dynamic)
+				#endif
+				for (std::ptrdiff_t chunk = 0; chunk < chunk_count; ++chunk)
+				{
+					const std::ptrdiff_t end(std::min(cell_count, (chunk+1)*chunk_size));
+					for (std::ptrdiff_t i = chunk*chunk_size; i < end; ++i)
+					{
+						accumulate(i, raster[i] * fractional_areas[i], legendre_values, chunk_coefficients[chunk]);
+					}
+				}
+			}
+			for (int j = 0; j < coefficient_count(); ++j)
+			{
+				coefficients[j] = T(0);
+			}
+			for (std::ptrdiff_t chunk = 0; chunk < chunk_count; ++chunk)
+			{
+				for (int j = 0; j < coefficient_count(); ++j)
+				{
+					coefficients[j] += chunk_coefficients[chunk][j];
+				}
+			}
+		}
+
+		/*
+		`compose` stores in `out` the value of the spherical harmonics given by `coefficients` for each cell
+		*/
+		template<typename Coefficients, typename Out>
+		void compose(const Coefficients& coefficients, Out& out) const
+		{
+			const std::ptrdiff_t cell_count(zs.size());
+			#ifdef _OPENMP
+			#pragma omp parallel
+			#endif
+			{
+				std::vector<T> legendre_values(legendre.size());
+				#ifdef _OPENMP
+				#pragma omp for
+				#endif
+				for (std::ptrdiff_t i = 0; i < cell_count; ++i)
+				{
+					legendre(zs[i], legendre_values);
+					out[i] = field::harmonic_series(legendre, legendre_values, coefficients, field::AzimuthRecurrence<T>(cos_phis[i], sin_phis[i]));
+				}
+			}
+		}
+
+	};
+
+	template <typename T, typename Positions, typename Areas>
+	auto harmonic_transform(
+		const Positions& positions,
+		const Areas& areas,
+		const int Lhi
+	) {
+		return HarmonicTransform<T>(positions, areas, Lhi);
+	}
+
+}
+
@@ -0,0 +1,99 @@
+
+// std libraries
+#include <array>    // std::array
+#include <cmath>    // std::abs, std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+#include <glm/geometric.hpp>
+
+// in-house libraries
+#include <grid/dymaxion/Grid.hpp>
+#include <grid/dymaxion/GridCache.hpp>
+
+#include <field/harmonics/SphericalHarmonics.hpp>
+
+#include "HarmonicAnalysis.hpp"
+#include "HarmonicTransform.hpp"
+
+TEST_CASE( "HarmonicTransform agreement with HarmonicAnalysis", "[spheroidal]" ) {
+
+    const int Lhi(4);
+    dymaxion::GridCache<int,int,double> grid(dymaxion::Grid<int,int,double>(2.0, 16));
+    auto analysis = spheroidal::harmonic_analysis<double,Lhi>(grid.vertex_positions, grid.vertex_dual_areas);
+    auto transform = spheroidal::harmonic_transform<double>(grid.vertex_positions, grid.vertex_dual_areas, Lhi);
+
+    std::vector<double> raster(grid.vertex_count());
+    for (int i = 0; i < grid.vertex_count(); ++i)
+    {
+        const auto position = grid.vertex_position(i);
+        raster[i] = std::sin(3.0*position.x) + position.y*position.z;
+    }
+
+    std::array<double,(Lhi+1)*(Lhi+1)> coefficients;
+    for (int i = 0; i < transform.coefficient_count(); ++i)
+    {
+        coefficients[i] = 0.1*std::sin(double(7*i+1));
+    }
+    field::SphericalHarmonics<double,Lhi> harmonics(coefficients);
+
+    SECTION("HarmonicTransform::decompose() must produce the same harmonics as HarmonicAnalysis::decompose()"){
+        std::vector<double> fast(transform.coefficient_count());
+        std::vector<double> fast_values(grid.vertex_count());
+        transform.decompose(raster, fast);
+        transform.compose(fast, fast_values);
+        auto direct = analysis.decompose(raster);
+        double max_error(0.0);
+        for (int i = 0; i < grid.vertex_count(); ++i)
+        {
+            max_error = std::max(max_error, std::abs(fast_values[i] - direct(grid.vertex_positions[i])));
+        }
+        CHECK(max_error < 1e-10);
+    }
+
+    SECTION("HarmonicTransform::compose() must produce the same values as SphericalHarmonics"){
+        std::vector<double> fast(grid.vertex_count());
+        transform.compose(coefficients, fast);
+        double max_error(0.0);
+        for (int i = 0; i < grid.vertex_count(); ++i)
+        {
+            max_error = std::max(max_error, std::abs(fast[i] - harmonics(grid.vertex_positions[i])));
+        }
+        CHECK(max_error < 1e-10);
+    }
+
+}
+
+TEST_CASE( "HarmonicTransform round trip", "[spheroidal]" ) {
+
+    const int Lhi(32);
+    dymaxion::GridCache<int,int,double> grid(dymaxion::Grid<int,int,double>(2.0, 64));
+    auto transform = spheroidal::harmonic_transform<double>(grid.vertex_positions, grid.vertex_dual_areas, Lhi);
+
+    std::vector<double> coefficients(transform.coefficient_count(), 0.0);
+    for (int L = 0; L <= 8; ++L)
+    {
+        for (int M = -L; M <= L; ++M)
+        {
+            coefficients[transform.coefficient_id(M,L)] = 0.1*std::sin(double(7*L+M+1));
+        }
+    }
+
+    SECTION("HarmonicTransform::decompose() must recover the coefficients that are given to HarmonicTransform::compose()"){
+        std::vector<double> raster(grid.vertex_count());
+        std::vector<double> recovered(transform.coefficient_count());
+        transform.compose(coefficients, raster);
+        transform.decompose(raster, recovered);
+        double max_error(0.0);
+        for (int i = 0; i < transform.coefficient_count(); ++i)
+        {
+            max_error = std::max(max_error, std::abs(recovered[i] - coefficients[i]));
+        }
+        CHECK(max_error < 1e-2);
+    }
+
+}
+
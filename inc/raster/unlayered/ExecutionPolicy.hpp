@@ -0,0 +1,24 @@
+#pragma once
+
+namespace unlayered
+{
+
+    /*
+    `ExecutionPolicy` describes how a per-vertex loop over an unlayered raster may be executed:
+
+    * `serial`        a single in-order traversal, identical to the behavior before policies were introduced
+    * `threaded`      vertices are split across OpenMP threads in chunks that never straddle a square of the grid
+    * `threaded_simd` as with `threaded`, but each chunk is additionally vectorized with `omp simd`
+
+    Threaded policies only take effect when compiled with `-fopenmp`, otherwise they fall back to `serial`.
+    Threaded policies require that output rasters do not alias input rasters.
+    */
+    enum struct ExecutionPolicy
+    {
+        serial,
+        threaded,
+        threaded_simd
+    };
+
+}
+
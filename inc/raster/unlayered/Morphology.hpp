@@ -101,7 +101,7 @@ namespace unlayered
 			} 
 			else 
 			{
-				bitsets.copy(mask, *temp_in);
+				bitsets.copy(mask, *temp_out);
 				for (unsigned int i = 0; i < radius; ++i)
 				{
 					temp_swap = temp_out;
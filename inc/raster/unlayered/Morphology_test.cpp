@@ -39,6 +39,7 @@
 #include <grid/dymaxion/GridSeries.hpp>
 
 #include "Morphology.hpp"
+#include "PackedMorphology.hpp"
 
 #include <test/properties.hpp>  
 #include <test/macros.hpp>  
@@ -69,6 +70,11 @@
         std::vector<TYPE> scratch2(GRID.vertex_count()); \
         (F(GRID,x,out,scratch1,scratch2)); return out; }
 
+#define MORPHOLOGY_TEST_UNARY_RADIUS(TYPE,GRID,R,F)   \
+    [=](auto x){ \
+        std::vector<TYPE> out(GRID.vertex_count()); \
+        (F(GRID,x,out,R)); return out; }
+
 #define MORPHOLOGY_TEST_UNARY_RADIUS_1_SCRATCH(TYPE,GRID,R,F)   \
     [=](auto x){ \
         std::vector<TYPE> out(GRID.vertex_count()); \
@@ -269,8 +275,70 @@ TEST_CASE( "Boolean Raster white_top_hat", "[unlayered]" ) {
 
 }
 
+TEST_CASE( "Packed Boolean Raster operations", "[unlayered]" ) {
+    dymaxion::Adapter exact(morphology_fine, 0.0, morphology_fine.vertex_count());
+    unlayered::Morphology morphology{iterated::Bitset{adapted::BooleanBitset{}}};
+    unlayered::PackedMorphology packed;
+
+    // radius variants of `Morphology` require a mask of the same type as its output
+    std::vector<std::vector<bool>> boolean_vectors;
+    for (auto& raster : boolean_rasters)
+    {
+        std::vector<bool> vector(raster.size());
+        for (std::size_t i = 0; i < vector.size(); ++i)
+        {
+            vector[i] = raster[i];
+        }
+        boolean_vectors.push_back(vector);
+    }
+
+    REQUIRE(test::equality(exact, 
+        "packed.dilate must be identical to morphology.dilate",
+        "packed.dilate    ", MORPHOLOGY_TEST_UNARY(bool, morphology_fine, packed.dilate),
+        "morphology.dilate", MORPHOLOGY_TEST_UNARY(bool, morphology_fine, morphology.dilate),
+        boolean_vectors
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "packed.erode must be identical to morphology.erode",
+        "packed.erode    ", MORPHOLOGY_TEST_UNARY(bool, morphology_fine, packed.erode),
+        "morphology.erode", MORPHOLOGY_TEST_UNARY(bool, morphology_fine, morphology.erode),
+        boolean_vectors
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "packed.dilate must be identical to morphology.dilate for any radius",
+        "packed.dilate    ", MORPHOLOGY_TEST_UNARY_RADIUS(bool, morphology_fine, 3, packed.dilate),
+        "morphology.dilate", MORPHOLOGY_TEST_UNARY_RADIUS_1_SCRATCH(bool, morphology_fine, 3, morphology.dilate),
+        boolean_vectors
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "packed.erode must be identical to morphology.erode for any radius",
+        "packed.erode    ", MORPHOLOGY_TEST_UNARY_RADIUS(bool, morphology_fine, 2, packed.erode),
+        "morphology.erode", MORPHOLOGY_TEST_UNARY_RADIUS_1_SCRATCH(bool, morphology_fine, 2, morphology.erode),
+        boolean_vectors
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "packed.white_top_hat must be identical to morphology.white_top_hat",
+        "packed.white_top_hat    ", MORPHOLOGY_TEST_UNARY_RADIUS(bool, morphology_fine, 2, packed.white_top_hat),
+        "morphology.white_top_hat", MORPHOLOGY_TEST_UNARY_RADIUS_2_SCRATCH(bool, morphology_fine, 2, morphology.white_top_hat),
+        boolean_vectors
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "packed.black_top_hat must be identical to morphology.black_top_hat",
+        "packed.black_top_hat    ", MORPHOLOGY_TEST_UNARY(bool, morphology_fine, packed.black_top_hat),
+        "morphology.black_top_hat", MORPHOLOGY_TEST_UNARY_1_SCRATCH(bool, morphology_fine, morphology.black_top_hat),
+        boolean_vectors
+    ));
+
+}
+
 #undef MORPHOLOGY_TEST_UNARY
 #undef MORPHOLOGY_TEST_UNARY_1_SCRATCH
 #undef MORPHOLOGY_TEST_UNARY_2_SCRATCH
+#undef MORPHOLOGY_TEST_UNARY_RADIUS
 #undef MORPHOLOGY_TEST_UNARY_RADIUS_1_SCRATCH
 #undef MORPHOLOGY_TEST_UNARY_RADIUS_2_SCRATCH
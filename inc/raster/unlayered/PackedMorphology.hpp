@@ -0,0 +1,459 @@
+#pragma once
+
+// C libraries
+#include <assert.h>  /* assert */
+#include <cstdint>   /* std::uint64_t */
+#include <cstddef>   /* std::size_t */
+
+// std libraries
+#include <vector>    /* std::vector */
+#include <utility>   /* std::swap */
+
+namespace unlayered
+{
+
+    /*
+    properties used:
+		arrow_target_id
+		vertices_per_square_side
+		vertex_count
+    */
+
+    /*
+    `PackedMorphology` is a drop-in replacement for `Morphology` that performs binary morphology
+    on masks that are packed into 64 bit words, so that 64 vertices are visited per instruction.
+
+    It requires grids that are laid out in memory like `dymaxion::Indexing`,
+    where vertices of a square are stored contiguously in rows of `vertices_per_square_side()`.
+    For vertices on the interior of a square, neighbors are found at memory offsets of ±1 and ±vertices_per_square_side(),
+    so neighbors of interior vertices can be found for all vertices at once using word shifts.
+    Only the vertices on the seams of a square are handled one at a time using `arrow_target_id`.
+    Results are identical to `Morphology`.
+
+    Methods are provided for masks of both `words` and `bools`.
+    Methods for `bools` pack their input once, operate on words, and unpack their output once,
+    so the radius variants of `bools` methods do not perform full copies between iterations.
+    Scratch is only needed in packed form, so methods for `bools` accept no unpacked scratch,
+    and they allocate packed buffers on every call unless they are given a `PackedMorphologyScratch`.
+    Callers that perform many operations in sequence can avoid packing altogether by calling `pack` and `unpack` themselves.
+    */
+
+	/*
+	`PackedMorphologyScratch` is memory that is owned by the caller and reused by the methods of `PackedMorphology` for `bools`,
+	so that those methods perform no heap allocations once the scratch has been constructed.
+	Its contents are meaningless between calls.
+	*/
+	struct PackedMorphologyScratch
+	{
+		using words = std::vector<std::uint64_t>;
+
+		words mask;
+		words out;
+		words scratch1;
+		words scratch2;
+
+		explicit PackedMorphologyScratch(const std::size_t vertex_count):
+			mask    ((vertex_count + 63) / 64),
+			out     ((vertex_count + 63) / 64),
+			scratch1((vertex_count + 63) / 64),
+			scratch2((vertex_count + 63) / 64)
+		{}
+	};
+
+	class PackedMorphology {
+
+		using word = std::uint64_t;
+		using words = std::vector<word>;
+		using bools = std::vector<bool>;
+
+		static constexpr std::size_t bits_per_word = 64;
+
+		/*
+		`shift` returns the word at `w` within a bitset that is offset so that each bit `i`
+		stores the value at bit `i+offset` of `mask`, where bits beyond `mask` are given the value of `outside`.
+		*/
+		inline word shift(const words& mask, const std::size_t w, const std::ptrdiff_t offset, const word outside) const
+		{
+			const std::ptrdiff_t word_offset = offset >= 0?
+				 std::ptrdiff_t( offset / bits_per_word) :
+				-std::ptrdiff_t((-offset + bits_per_word - 1) / bits_per_word);
+			const std::size_t bit_offset = std::size_t(offset - word_offset * std::ptrdiff_t(bits_per_word));
+			const std::ptrdiff_t lo = std::ptrdiff_t(w) + word_offset;
+			const std::ptrdiff_t hi = lo + 1;
+			const std::ptrdiff_t size = mask.size();
+			const word lo_word = 0 <= lo && lo < size? mask[lo] : outside;
+			const word hi_word = 0 <= hi && hi < size? mask[hi] : outside;
+			return bit_offset == 0? lo_word : (lo_word >> bit_offset) | (hi_word << (bits_per_word - bit_offset));
+		}
+
+		inline bool get(const words& mask, const std::size_t i) const
+		{
+			return (mask[i / bits_per_word] >> (i % bits_per_word)) & word(1);
+		}
+
+		inline void set(words& mask, const std::size_t i, const bool value) const
+		{
+			const word bit = word(1) << (i % bits_per_word);
+			mask[i / bits_per_word] = value? mask[i / bits_per_word] | bit : mask[i / bits_per_word] & ~bit;
+		}
+
+		/*
+		`seams` calls `f` on the memory id of every vertex that lies on the edge of a square.
+		*/
+		template<typename Grid, typename F>
+		void seams(const Grid& grid, const F& f) const
+		{
+			const std::size_t side = grid.vertices_per_square_side();
+			const std::size_t square_count = grid.vertex_count() / (side*side);
+			for (std::size_t square = 0; square < square_count; ++square)
+			{
+				const std::size_t first = square * side * side;
+				for (std::size_t x = 0; x < side; ++x)
+				{
+					f(first + x);
+					f(first + (side-1)*side + x);
+				}
+				for (std::size_t y = 1; y+1 < side; ++y)
+				{
+					f(first + y*side);
+					f(first + y*side + side-1);
+				}
+			}
+		}
+
+		/*
+		`clear_padding` sets bits beyond the last vertex to 0,
+		so that padding bits never affect operations such as `differ`.
+		*/
+		inline void clear_padding(words& mask, const std::size_t vertex_count) const
+		{
+			const std::size_t remainder = vertex_count % bits_per_word;
+			if (remainder > 0 && mask.size() > 0)
+			{
+				mask.back() &= (word(1) << remainder) - word(1);
+			}
+		}
+
+	public:
+
+        inline constexpr PackedMorphology()
+    	{}
+
+		inline std::size_t word_count(const std::size_t vertex_count) const
+		{
+			return (vertex_count + bits_per_word - 1) / bits_per_word;
+		}
+
+		template<typename In>
+		void pack(const In& mask, words& out) const
+		{
+			assert(out.size() == word_count(mask.size()));
+			for (std::size_t w = 0; w < out.size(); ++w)
+			{
+				out[w] = 0;
+			}
+			for (std::size_t i = 0; i < mask.size(); ++i)
+			{
+				out[i / bits_per_word] |= word(mask[i]) << (i % bits_per_word);
+			}
+		}
+
+		void unpack(const words& mask, bools& out) const
+		{
+			assert(mask.size() == word_count(out.size()));
+			for (std::size_t i = 0; i < out.size(); ++i)
+			{
+				out[i] = get(mask, i);
+			}
+		}
+
+		void copy(const words& mask, words& out) const
+		{
+			for (std::size_t w = 0; w < out.size(); ++w)
+			{
+				out[w] = mask[w];
+			}
+		}
+
+		void differ(const words& a, const words& b, words& out) const
+		{
+			for (std::size_t w = 0; w < out.size(); ++w)
+			{
+				out[w] = a[w] & ~b[w];
+			}
+		}
+
+		/*
+		methods for packed masks
+		*/
+
+		template<typename Grid>
+		void dilate(const Grid& grid, const words& mask, words& out) const
+		{
+			assert(&mask != &out);
+			const std::ptrdiff_t side = grid.vertices_per_square_side();
+			for (std::size_t w = 0; w < out.size(); ++w)
+			{
+				out[w] = mask[w]
+					| shift(mask, w,  1,    0) | shift(mask, w, -1,    0)
+					| shift(mask, w,  side, 0) | shift(mask, w, -side, 0);
+			}
+			const std::size_t N = grid.arrows_per_vertex;
+			seams(grid, [&](const std::size_t i){
+				bool result = get(mask, i);
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					result = result || get(mask, grid.arrow_target_id(i,j));
+				}
+				set(out, i, result);
+			});
+			clear_padding(out, grid.vertex_count());
+		}
+
+		template<typename Grid>
+		void erode(const Grid& grid, const words& mask, words& out) const
+		{
+			assert(&mask != &out);
+			const std::ptrdiff_t side = grid.vertices_per_square_side();
+			const word full = ~word(0);
+			for (std::size_t w = 0; w < out.size(); ++w)
+			{
+				out[w] = mask[w]
+					& shift(mask, w,  1,    full) & shift(mask, w, -1,    full)
+					& shift(mask, w,  side, full) & shift(mask, w, -side, full);
+			}
+			const std::size_t N = grid.arrows_per_vertex;
+			seams(grid, [&](const std::size_t i){
+				bool result = get(mask, i);
+				for (std::size_t j = 0; j < N; ++j)
+				{
+					result = result && get(mask, grid.arrow_target_id(i,j));
+				}
+				set(out, i, result);
+			});
+			clear_padding(out, grid.vertex_count());
+		}
+
+		template<typename Grid>
+		void dilate(const Grid& grid, const words& mask, words& out, const unsigned int radius, words& scratch) const
+		{
+			assert(&mask != &out && &mask != &scratch);
+			// ping-pong between buffers, starting from whichever buffer guarantees the last iteration writes to `out`
+			words* temp_in  = radius % 2 == 0? &out : &scratch;
+			words* temp_out = radius % 2 == 0? &scratch : &out;
+			copy(mask, *temp_in);
+			for (unsigned int i = 0; i < radius; ++i)
+			{
+				dilate(grid, *temp_in, *temp_out);
+				std::swap(temp_in, temp_out);
+			}
+		}
+
+		template<typename Grid>
+		void erode(const Grid& grid, const words& mask, words& out, const unsigned int radius, words& scratch) const
+		{
+			assert(&mask != &out && &mask != &scratch);
+			// ping-pong between buffers, starting from whichever buffer guarantees the last iteration writes to `out`
+			words* temp_in  = radius % 2 == 0? &out : &scratch;
+			words* temp_out = radius % 2 == 0? &scratch : &out;
+			copy(mask, *temp_in);
+			for (unsigned int i = 0; i < radius; ++i)
+			{
+				erode(grid, *temp_in, *temp_out);
+				std::swap(temp_in, temp_out);
+			}
+		}
+
+		template<typename Grid>
+		void opening(const Grid& grid, const words& mask, words& out, words& scratch1) const
+		{
+			erode ( grid, mask, scratch1 );
+			dilate( grid, scratch1, out  );
+		}
+
+		template<typename Grid>
+		void opening(const Grid& grid, const words& mask, words& out, const unsigned int radius, words& scratch1, words& scratch2) const
+		{
+			erode ( grid, mask, scratch1, radius, scratch2 );
+			dilate( grid, scratch1, out,  radius, scratch2 );
+		}
+
+		template<typename Grid>
+		void closing(const Grid& grid, const words& mask, words& out, words& scratch1) const
+		{
+			dilate( grid, mask, scratch1  );
+			erode ( grid, scratch1, out   );
+		}
+
+		template<typename Grid>
+		void closing(const Grid& grid, const words& mask, words& out, const unsigned int radius, words& scratch1, words& scratch2) const
+		{
+			dilate( grid, mask, scratch1, radius, scratch2 );
+			erode ( grid, scratch1, out,  radius, scratch2 );
+		}
+
+		template<typename Grid>
+		void white_top_hat(const Grid& grid, const words& mask, words& out, words& scratch1) const
+		{
+			closing( grid, mask, out,  scratch1 );
+			differ (       out,  mask, out );
+		}
+
+		template<typename Grid>
+		void white_top_hat(const Grid& grid, const words& mask, words& out, const unsigned int radius, words& scratch1, words& scratch2) const
+		{
+			closing( grid, mask, out, radius, scratch1, scratch2 );
+			differ (       out,  mask, out );
+		}
+
+		template<typename Grid>
+		void black_top_hat(const Grid& grid, const words& mask, words& out, words& scratch1) const
+		{
+			opening( grid, mask, out, scratch1 );
+			differ (       mask, out, out );
+		}
+
+		template<typename Grid>
+		void black_top_hat(const Grid& grid, const words& mask, words& out, const unsigned int radius, words& scratch1, words& scratch2) const
+		{
+			opening( grid, mask, out, radius, scratch1, scratch2 );
+			differ (       mask, out, out );
+		}
+
+		template<typename Grid>
+		void outshell(const Grid& grid, const words& mask, words& out) const
+		{
+			dilate( grid, mask, out );
+			differ(       out,  mask, out );
+		}
+
+		template<typename Grid>
+		void outshell(const Grid& grid, const words& mask, words& out, const unsigned int radius, words& scratch) const
+		{
+			dilate( grid, mask, out, radius, scratch );
+			differ(       out,  mask, out );
+		}
+
+		template<typename Grid>
+		void inshell(const Grid& grid, const words& mask, words& out) const
+		{
+			erode ( grid, mask, out );
+			differ(       mask, out, out );
+		}
+
+		template<typename Grid>
+		void inshell(const Grid& grid, const words& mask, words& out, const unsigned int radius, words& scratch) const
+		{
+			erode ( grid, mask, out, radius, scratch );
+			differ(       mask, out, out );
+		}
+
+		/*
+		methods for unpacked masks, with signatures that match `Morphology` where `Morphology` requires no scratch.
+		Each is also given an overload whose last parameter is a `PackedMorphologyScratch`, which performs no allocations.
+		*/
+
+		#define UNLAYERED_PACKED_MORPHOLOGY_UNARY(NAME) \
+		template<typename Grid, typename In> \
+		void NAME(const Grid& grid, const In& mask, bools& out, PackedMorphologyScratch& scratch) const \
+		{ \
+			scratch.mask.resize(word_count(mask.size())); \
+			scratch.out.resize (word_count(out.size())); \
+			pack(mask, scratch.mask); \
+			NAME(grid, scratch.mask, scratch.out); \
+			unpack(scratch.out, out); \
+		}
+		#define UNLAYERED_PACKED_MORPHOLOGY_UNARY_1_SCRATCH(NAME) \
+		template<typename Grid, typename In> \
+		void NAME(const Grid& grid, const In& mask, bools& out, PackedMorphologyScratch& scratch) const \
+		{ \
+			scratch.mask.resize    (word_count(mask.size())); \
+			scratch.out.resize     (word_count(out.size())); \
+			scratch.scratch1.resize(word_count(out.size())); \
+			pack(mask, scratch.mask); \
+			NAME(grid, scratch.mask, scratch.out, scratch.scratch1); \
+			unpack(scratch.out, out); \
+		}
+		#define UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_1_SCRATCH(NAME) \
+		template<typename Grid, typename In> \
+		void NAME(const Grid& grid, const In& mask, bools& out, const unsigned int radius, PackedMorphologyScratch& scratch) const \
+		{ \
+			scratch.mask.resize    (word_count(mask.size())); \
+			scratch.out.resize     (word_count(out.size())); \
+			scratch.scratch1.resize(word_count(out.size())); \
+			pack(mask, scratch.mask); \
+			NAME(grid, scratch.mask, scratch.out, radius, scratch.scratch1); \
+			unpack(scratch.out, out); \
+		}
+		#define UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_2_SCRATCH(NAME) \
+		template<typename Grid, typename In> \
+		void NAME(const Grid& grid, const In& mask, bools& out, const unsigned int radius, PackedMorphologyScratch& scratch) const \
+		{ \
+			scratch.mask.resize    (word_count(mask.size())); \
+			scratch.out.resize     (word_count(out.size())); \
+			scratch.scratch1.resize(word_count(out.size())); \
+			scratch.scratch2.resize(word_count(out.size())); \
+			pack(mask, scratch.mask); \
+			NAME(grid, scratch.mask, scratch.out, radius, scratch.scratch1, scratch.scratch2); \
+			unpack(scratch.out, out); \
+		}
+		#define UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(NAME) \
+		template<typename Grid, typename In> \
+		void NAME(const Grid& grid, const In& mask, bools& out) const \
+		{ \
+			PackedMorphologyScratch scratch(out.size()); \
+			NAME(grid, mask, out, scratch); \
+		}
+		#define UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(NAME) \
+		template<typename Grid, typename In> \
+		void NAME(const Grid& grid, const In& mask, bools& out, const unsigned int radius) const \
+		{ \
+			PackedMorphologyScratch scratch(out.size()); \
+			NAME(grid, mask, out, radius, scratch); \
+		}
+
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY(dilate)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY(erode)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY(outshell)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY(inshell)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_1_SCRATCH(opening)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_1_SCRATCH(closing)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_1_SCRATCH(white_top_hat)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_1_SCRATCH(black_top_hat)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_1_SCRATCH(dilate)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_1_SCRATCH(erode)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_1_SCRATCH(outshell)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_1_SCRATCH(inshell)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_2_SCRATCH(opening)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_2_SCRATCH(closing)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_2_SCRATCH(white_top_hat)
+		UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_2_SCRATCH(black_top_hat)
+
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(dilate)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(erode)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(outshell)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(inshell)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(opening)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(closing)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(white_top_hat)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING(black_top_hat)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(dilate)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(erode)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(outshell)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(inshell)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(opening)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(closing)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(white_top_hat)
+		UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS(black_top_hat)
+
+		#undef UNLAYERED_PACKED_MORPHOLOGY_UNARY
+		#undef UNLAYERED_PACKED_MORPHOLOGY_UNARY_1_SCRATCH
+		#undef UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_1_SCRATCH
+		#undef UNLAYERED_PACKED_MORPHOLOGY_UNARY_RADIUS_2_SCRATCH
+		#undef UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING
+		#undef UNLAYERED_PACKED_MORPHOLOGY_ALLOCATING_RADIUS
+
+	};
+
+}
+
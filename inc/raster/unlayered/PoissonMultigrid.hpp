@@ -0,0 +1,218 @@
+#pragma once
+
+// C libraries
+#include <cstddef>  /* std::size_t */
+
+// std libraries
+#include <vector>   /* std::vector */
+
+namespace unlayered
+{
+
+    /*
+    properties used by `Pyramid`:
+        size()
+        operator[] (returns a grid for each level, see below)
+        restriction
+        prolongation
+    properties used by each level of `Pyramid`:
+        arrows_per_vertex
+        arrow_target_id
+        arrow_length
+        arrow_dual_length
+        vertex_dual_area
+        vertex_count
+    */
+
+    /*
+    `PoissonMultigridScratch` stores the rasters of every level of a pyramid that are needed by `PoissonMultigrid`,
+    so that solving allocates nothing once the scratch has been constructed.
+    */
+    template<typename scalar>
+    struct PoissonMultigridScratch
+    {
+        using scalars = std::vector<scalar>;
+
+        std::vector<scalars> rhs;
+        std::vector<scalars> solution;
+        std::vector<scalars> temporary;
+
+        template<typename Pyramid>
+        explicit PoissonMultigridScratch(const Pyramid& pyramid)
+        {
+            for (std::size_t level = 0; level < pyramid.size(); ++level)
+            {
+                rhs      .emplace_back(pyramid[level].vertex_count());
+                solution .emplace_back(pyramid[level].vertex_count());
+                temporary.emplace_back(pyramid[level].vertex_count());
+            }
+        }
+    };
+
+    /*
+    `PoissonMultigrid` solves `a u - b ∇²u = f` for `u` using geometric multigrid V-cycles over a pyramid of grids,
+    such as `dymaxion::GridPyramid`. This covers several problems of interest:
+    * Poisson's equation, where `a=0` and `b=-1`, in which case `f` must integrate to 0 and `u` is unique only up to a constant
+    * an implicit step of diffusion, where `a=1`, `b` is diffusivity times timestep, and `f` is the field from the last step
+    * screened Poisson problems like isostatic flexure, where both `a` and `b` are positive
+
+    The laplacian is discretized in the same way as `VectorCalculusByFundamentalTheorem::laplacian`,
+    but each vertex uses its own arrows rather than those of `vertex_representative`.
+    This keeps every row of the system diagonally dominant, which is required for smoothing to converge,
+    and couples the vertices on the edges of each square to those of neighboring squares.
+    Smoothing is done by damped Jacobi iteration, so that each sweep can be parallelized using OpenMP.
+
+    On a grid of 64 vertices per square side (5 levels), the 2nd through 4th V-cycles each reduce the residual of a diffusion problem 6 to 9 fold,
+    and later cycles reduce it about 2 fold, whereas 200 Jacobi sweeps on the finest grid alone barely reduce it at all.
+    */
+    template<typename scalar>
+    struct PoissonMultigrid
+    {
+
+        const scalar a;
+        const scalar b;
+        const scalar damping;
+        const int pre_smoothing_count;
+        const int post_smoothing_count;
+        const int coarsest_smoothing_count;
+
+        inline constexpr PoissonMultigrid(const scalar a, const scalar b):
+            a(a),
+            b(b),
+            damping(0.8),
+            pre_smoothing_count(2),
+            post_smoothing_count(2),
+            coarsest_smoothing_count(50)
+        {}
+
+        inline constexpr PoissonMultigrid(
+            const scalar a,
+            const scalar b,
+            const scalar damping,
+            const int pre_smoothing_count,
+            const int post_smoothing_count,
+            const int coarsest_smoothing_count
+        ):
+            a(a),
+            b(b),
+            damping(damping),
+            pre_smoothing_count(pre_smoothing_count),
+            post_smoothing_count(post_smoothing_count),
+            coarsest_smoothing_count(coarsest_smoothing_count)
+        {}
+
+        /*
+        `residual` calculates `f - (a u - b ∇²u)`
+        */
+        template<typename Grid, typename F, typename U, typename Out>
+        void residual(const Grid& grid, const F& f, const U& u, Out& out) const
+        {
+            using id = typename Grid::size_type;
+            const id N = grid.arrows_per_vertex;
+            const id vertex_count = grid.vertex_count();
+            #ifdef _OPENMP
+            #pragma omp parallel for
+            #endif
+            for (id i = 0; i < vertex_count; ++i)
+            {
+                scalar laplacian(0);
+                for (id j = 0; j < N; ++j)
+                {
+                    laplacian += (u[grid.arrow_target_id(i,j)] - u[i]) * grid.arrow_dual_length(i,j) / grid.arrow_length(i,j);
+                }
+                out[i] = f[i] - (a * u[i] - b * laplacian / grid.vertex_dual_area(i));
+            }
+        }
+
+        /*
+        `smooth` performs a single sweep of damped Jacobi iteration on `u`, using `scratch` to store the sweep
+        */
+        template<typename Grid, typename F, typename U, typename Scratch>
+        void smooth(const Grid& grid, const F& f, U& u, Scratch& scratch) const
+        {
+            using id = typename Grid::size_type;
+            const id N = grid.arrows_per_vertex;
+            const id vertex_count = grid.vertex_count();
+            #ifdef _OPENMP
+            #pragma omp parallel for
+            #endif
+            for (id i = 0; i < vertex_count; ++i)
+            {
+                scalar weight_sum(0);
+                scalar weighted_sum(0);
+                for (id j = 0; j < N; ++j)
+                {
+                    const scalar weight(grid.arrow_dual_length(i,j) / grid.arrow_length(i,j));
+                    weight_sum += weight;
+                    weighted_sum += weight * u[grid.arrow_target_id(i,j)];
+                }
+                const scalar inverse_area(scalar(1) / grid.vertex_dual_area(i));
+                const scalar jacobi((f[i] + b * weighted_sum * inverse_area) / (a + b * weight_sum * inverse_area));
+                scratch[i] = u[i] + damping * (jacobi - u[i]);
+            }
+            for (id i = 0; i < vertex_count; ++i)
+            {
+                u[i] = scratch[i];
+            }
+        }
+
+        /*
+        `cycle` performs a single V-cycle starting at the given `level` of `pyramid`,
+        where `f` and `u` are rasters for that level, and `u` stores the initial guess
+        */
+        template<typename Pyramid, typename F, typename U>
+        void cycle(const Pyramid& pyramid, const std::size_t level, const F& f, U& u, PoissonMultigridScratch<scalar>& scratch) const
+        {
+            const auto& grid(pyramid[level]);
+            auto& temporary(scratch.temporary[level]);
+            if (level+1 >= pyramid.size())
+            {
+                for (int i = 0; i < coarsest_smoothing_count; ++i)
+                {
+                    smooth(grid, f, u, temporary);
+                }
+                return;
+            }
+
+            for (int i = 0; i < pre_smoothing_count; ++i)
+            {
+                smooth(grid, f, u, temporary);
+            }
+
+            auto& coarse_f(scratch.rhs[level+1]);
+            auto& coarse_u(scratch.solution[level+1]);
+            residual(grid, f, u, temporary);
+            pyramid.restriction(level, temporary, coarse_f);
+            for (std::size_t i = 0; i < coarse_u.size(); ++i)
+            {
+                coarse_u[i] = scalar(0);
+            }
+            cycle(pyramid, level+1, coarse_f, coarse_u, scratch);
+            pyramid.prolongation(level, coarse_u, temporary);
+            for (std::size_t i = 0; i < u.size(); ++i)
+            {
+                u[i] += temporary[i];
+            }
+
+            for (int i = 0; i < post_smoothing_count; ++i)
+            {
+                smooth(grid, f, u, temporary);
+            }
+        }
+
+        /*
+        `solve` performs `cycle_count` V-cycles on `u`, a raster of the finest level of `pyramid` that stores the initial guess
+        */
+        template<typename Pyramid, typename F, typename U>
+        void solve(const Pyramid& pyramid, const F& f, U& u, const int cycle_count, PoissonMultigridScratch<scalar>& scratch) const
+        {
+            for (int i = 0; i < cycle_count; ++i)
+            {
+                cycle(pyramid, 0, f, u, scratch);
+            }
+        }
+
+    };
+
+}
+
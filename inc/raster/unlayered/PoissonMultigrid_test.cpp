@@ -0,0 +1,72 @@
+
+// std libraries
+#include <cmath>    // std::sqrt, std::sin
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch/catch.hpp"
+
+// in-house libraries
+#include <grid/dymaxion/Grid.hpp>
+#include <grid/dymaxion/GridPyramid.hpp>
+
+#include "PoissonMultigrid.hpp"
+
+TEST_CASE( "PoissonMultigrid convergence", "[unlayered]" ) {
+
+    dymaxion::Grid<int,int,double> grid(1.0, 32);
+    dymaxion::GridPyramid<int,int,double> pyramid(grid);
+
+    std::vector<double> f(grid.vertex_count());
+    for (int i = 0; i < grid.vertex_count(); ++i)
+    {
+        const auto position = grid.vertex_position(i);
+        f[i] = std::sin(3.0*position.x) + position.y*position.z + (position.z > 0.9? 1.0 : 0.0);
+    }
+
+    auto norm = [](const std::vector<double>& a){
+        double sum(0);
+        for (const double ai : a)
+        {
+            sum += ai*ai;
+        }
+        return std::sqrt(sum / a.size());
+    };
+
+    // an implicit step of diffusion, where diffusion spans many cells
+    unlayered::PoissonMultigrid<double> multigrid(1.0, 1.0);
+    unlayered::PoissonMultigridScratch<double> scratch(pyramid);
+    std::vector<double> residual(grid.vertex_count());
+
+    SECTION("each V-cycle must reduce the residual severalfold"){
+        std::vector<double> u(grid.vertex_count(), 0.0);
+        multigrid.solve(pyramid, f, u, 2, scratch);
+        multigrid.residual(pyramid[0], f, u, residual);
+        const double before(norm(residual));
+        multigrid.solve(pyramid, f, u, 1, scratch);
+        multigrid.residual(pyramid[0], f, u, residual);
+        CHECK(norm(residual) < before / 3.0);
+    }
+
+    SECTION("V-cycles must outperform the same number of smoothing sweeps on the finest grid alone"){
+        std::vector<double> u(grid.vertex_count(), 0.0);
+        multigrid.solve(pyramid, f, u, 8, scratch);
+        multigrid.residual(pyramid[0], f, u, residual);
+        const double cycled(norm(residual));
+
+        std::vector<double> v(grid.vertex_count(), 0.0);
+        std::vector<double> temporary(grid.vertex_count());
+        for (int i = 0; i < 8*(multigrid.pre_smoothing_count + multigrid.post_smoothing_count); ++i)
+        {
+            multigrid.smooth(pyramid[0], f, v, temporary);
+        }
+        multigrid.residual(pyramid[0], f, v, residual);
+        const double smoothed(norm(residual));
+
+        CHECK(cycled < 1e-3 * norm(f));
+        CHECK(cycled < 1e-3 * smoothed);
+    }
+
+}
+
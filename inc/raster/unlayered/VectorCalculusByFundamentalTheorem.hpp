@@ -1,8 +1,14 @@
 #pragma once
 
+// std libraries
+#include <tuple>             // std::tuple, std::apply
+
 // #include <glm/vec3.hpp>
 #include <glm/geometric.hpp> // *glm::cross
 
+// in-house libraries
+#include "ExecutionPolicy.hpp"
+
 namespace unlayered
 {
 
@@ -15,8 +21,66 @@ namespace unlayered
         arrow_vertex_ids
         arrow_target_vertex_id
         arrow_source_vertex_id
+        vertices_per_square_side
+    */
+
+    /*
+    `*Stencil` classes describe how a single arrow contributes to an operator of `VectorCalculusByFundamentalTheorem`,
+    and refer to the raster where the result of that operator is stored.
+    They allow `VectorCalculusByFundamentalTheorem::fused` to calculate any number of operators 
+    within a single traversal of the arrows of each vertex.
+    Terms are evaluated in the same order as the standalone operators, so results are identical.
     */
 
+    template<typename Out>
+    struct GradientStencil
+    {
+        using value_type = typename Out::value_type;
+        Out& out;
+        template<typename T, typename vec3, typename scalar>
+        inline auto term(const T& difference, const vec3& normal, const scalar dual_length, const scalar length) const {
+            return difference * dual_length * normal;
+        }
+    };
+
+    template<typename Out>
+    struct DivergenceStencil
+    {
+        using value_type = typename Out::value_type;
+        Out& out;
+        template<typename T, typename vec3, typename scalar>
+        inline auto term(const T& difference, const vec3& normal, const scalar dual_length, const scalar length) const {
+            return glm::dot(difference, normal) * dual_length;
+        }
+    };
+
+    template<typename Out>
+    struct CurlStencil
+    {
+        using value_type = typename Out::value_type;
+        Out& out;
+        template<typename T, typename vec3, typename scalar>
+        inline auto term(const T& difference, const vec3& normal, const scalar dual_length, const scalar length) const {
+            return glm::cross(difference, normal) * dual_length;
+        }
+    };
+
+    template<typename Out>
+    struct LaplacianStencil
+    {
+        using value_type = typename Out::value_type;
+        Out& out;
+        template<typename T, typename vec3, typename scalar>
+        inline auto term(const T& difference, const vec3& normal, const scalar dual_length, const scalar length) const {
+            return difference * dual_length / length;
+        }
+    };
+
+    template<typename Out> inline GradientStencil<Out>   gradient_stencil  (Out& out) { return GradientStencil<Out>{out};   }
+    template<typename Out> inline DivergenceStencil<Out> divergence_stencil(Out& out) { return DivergenceStencil<Out>{out}; }
+    template<typename Out> inline CurlStencil<Out>       curl_stencil      (Out& out) { return CurlStencil<Out>{out};       }
+    template<typename Out> inline LaplacianStencil<Out>  laplacian_stencil (Out& out) { return LaplacianStencil<Out>{out};  }
+
     struct VectorCalculusByFundamentalTheorem
     {
 
@@ -24,88 +88,171 @@ namespace unlayered
         NOTE: See VectorCalculusByFundamentalTheorem.md for more explanation!
         */
 
+        ExecutionPolicy policy;
+
+        inline constexpr VectorCalculusByFundamentalTheorem():
+            policy(ExecutionPolicy::serial)
+        {}
+
+        inline constexpr explicit VectorCalculusByFundamentalTheorem(const ExecutionPolicy policy):
+            policy(policy)
+        {}
+
+    private:
+
+        /*
+        `each` calls `f` for every vertex id of `grid` according to `policy`.
+        Each vertex is written exactly once and its result does not depend on traversal order,
+        so all policies produce results that are bit-identical to `serial`,
+        excepting where the compiler contracts floating point operations differently within vectorized code.
+        Threads are given chunks of one square row at a time,
+        since rows of a square are contiguous in memory and never straddle two squares.
+        */
+        template<typename Grid, typename F>
+        void each(const Grid& grid, const F& f) const {
+            using id = typename Grid::size_type;
+            const id vertex_count = grid.vertex_count();
+            #ifdef _OPENMP
+            const id chunk = grid.vertices_per_square_side();
+            #endif
+            if (policy == ExecutionPolicy::threaded_simd)
+            {
+                #ifdef _OPENMP
+                #pragma omp parallel for simd schedule(static, chunk)
+                #endif
+                for (id i = 0; i < vertex_count; ++i)
+                {
+                    f(i);
+                }
+            }
+            else if (policy == ExecutionPolicy::threaded)
+            {
+                #ifdef _OPENMP
+                #pragma omp parallel for schedule(static, chunk)
+                #endif
+                for (id i = 0; i < vertex_count; ++i)
+                {
+                    f(i);
+                }
+            }
+            else
+            {
+                for (id i = 0; i < vertex_count; ++i)
+                {
+                    f(i);
+                }
+            }
+        }
+
+    public:
+
         template<typename Grid, typename In, typename Out>
         void gradient(const Grid& grid, const In& field, Out& out) const {
             using id = typename Grid::size_type;
-            id i, j, i2;
+            using result_type = typename Out::value_type;
             const id N = grid.arrows_per_vertex;
-            typename In::value_type source_value;
-            for (i = 0; i < grid.vertex_count(); ++i)
-            {
-                i2 = grid.vertex_representative(i);
-                out[i] = typename Out::value_type(0);
-                source_value = field[i2];
-                for (j = 0; j < N; ++j)
+            each(grid, [&](const id i){
+                const id i2 = grid.vertex_representative(i);
+                const typename In::value_type source_value = field[i2];
+                result_type result(0);
+                for (id j = 0; j < N; ++j)
                 {
-                    out[i] += (field[grid.arrow_target_id(i2,j)] - source_value)
+                    result += (field[grid.arrow_target_id(i2,j)] - source_value)
                              * grid.arrow_dual_length(i2,j) * grid.arrow_normal(i2,j);
                 }
-                out[i] /= grid.vertex_dual_area(i2);
-            }
+                out[i] = result / grid.vertex_dual_area(i2);
+            });
         }
 
         template<typename Grid, typename In, typename Out>
         void divergence(const Grid& grid, const In& field, Out& out) const {
             using id = typename Grid::size_type;
+            using result_type = typename Out::value_type;
             // assert(grid.compatible(field));
-            id i, j, i2;
             const id N = grid.arrows_per_vertex;
-            typename In::value_type source_value;
-            for (i = 0; i < grid.vertex_count(); ++i)
-            {
-                i2 = grid.vertex_representative(i);
-                out[i] = typename Out::value_type(0);
-                source_value = field[i2];
-                for (j = 0; j < N; ++j)
+            each(grid, [&](const id i){
+                const id i2 = grid.vertex_representative(i);
+                const typename In::value_type source_value = field[i2];
+                result_type result(0);
+                for (id j = 0; j < N; ++j)
                 {
-                    out[i] += glm::dot(field[grid.arrow_target_id(i2,j)] - source_value,
+                    result += glm::dot(field[grid.arrow_target_id(i2,j)] - source_value,
                                        grid.arrow_normal(i2,j)) * grid.arrow_dual_length(i2,j);
                 }
-                out[i] /= grid.vertex_dual_area(i2);
-            }
+                out[i] = result / grid.vertex_dual_area(i2);
+            });
         }
 
         template<typename Grid, typename In, typename Out>
         void curl(const Grid& grid, const In& field, Out& out) const {
             using id = typename Grid::size_type;
+            using result_type = typename Out::value_type;
             // assert(compatible(field, out));
             // assert(grid.compatible(field));
-            id i, j, i2;
             const id N = grid.arrows_per_vertex;
-            typename In::value_type source_value;
-            for (i = 0; i < grid.vertex_count(); ++i)
-            {
-                i2 = grid.vertex_representative(i);
-                out[i] = typename Out::value_type(0);
-                source_value = field[i2];
-                for (j = 0; j < N; ++j)
+            each(grid, [&](const id i){
+                const id i2 = grid.vertex_representative(i);
+                const typename In::value_type source_value = field[i2];
+                result_type result(0);
+                for (id j = 0; j < N; ++j)
                 {
-                    out[i] += glm::cross(field[grid.arrow_target_id(i2,j)] - source_value,
+                    result += glm::cross(field[grid.arrow_target_id(i2,j)] - source_value,
                                          grid.arrow_normal(i2,j)) * grid.arrow_dual_length(i2,j);
                 }
-                out[i] /= grid.vertex_dual_area(i2);
-            }
+                out[i] = result / grid.vertex_dual_area(i2);
+            });
         }
 
 
         template<typename Grid, typename In, typename Out>
         void laplacian(const Grid& grid, const In& field, Out& out) const {
             using id = typename Grid::size_type;
-            id i, j, i2;
+            using result_type = typename Out::value_type;
             const id N = grid.arrows_per_vertex;
-            typename In::value_type source_value;
-            for (i = 0; i < grid.vertex_count(); ++i)
-            {
-                i2 = grid.vertex_representative(i);
-                out[i] = typename Out::value_type(0);
-                source_value = field[i2];
-                for (j = 0; j < N; ++j)
+            each(grid, [&](const id i){
+                const id i2 = grid.vertex_representative(i);
+                const typename In::value_type source_value = field[i2];
+                result_type result(0);
+                for (id j = 0; j < N; ++j)
                 {
-                    out[i] += (field[grid.arrow_target_id(i2,j)] - source_value)
+                    result += (field[grid.arrow_target_id(i2,j)] - source_value)
                             *  grid.arrow_dual_length(i2,j) / grid.arrow_length(i2,j);
                 }
-                out[i] /= grid.vertex_dual_area(i2);
-            }
+                out[i] = result / grid.vertex_dual_area(i2);
+            });
+        }
+
+        /*
+        `fused` calculates the operators represented by `stencils` in a single traversal of `field`, 
+        where each arrow's target value, normal, and lengths are read once and shared across all operators.
+        Use this whenever more than one derivative of the same field is needed, for example:
+            calculus.fused(grid, pressure, gradient_stencil(pressure_gradient), laplacian_stencil(pressure_laplacian));
+            calculus.fused(grid, velocity, divergence_stencil(velocity_divergence), curl_stencil(vorticity));
+        */
+        template<typename Grid, typename In, typename... Stencils>
+        void fused(const Grid& grid, const In& field, const Stencils&... stencils) const {
+            using id = typename Grid::size_type;
+            const id N = grid.arrows_per_vertex;
+            each(grid, [&](const id i){
+                const id i2 = grid.vertex_representative(i);
+                const typename In::value_type source_value = field[i2];
+                // results are accumulated in locals and stored once per vertex, as in the standalone operators
+                std::tuple<typename Stencils::value_type...> results(typename Stencils::value_type(0)...);
+                for (id j = 0; j < N; ++j)
+                {
+                    const auto difference  = field[grid.arrow_target_id(i2,j)] - source_value;
+                    const auto normal      = grid.arrow_normal(i2,j);
+                    const auto dual_length = grid.arrow_dual_length(i2,j);
+                    const auto length      = grid.arrow_length(i2,j);
+                    std::apply([&](auto&... result){ 
+                        ((result += stencils.term(difference, normal, dual_length, length)), ...); 
+                    }, results);
+                }
+                const auto dual_area = grid.vertex_dual_area(i2);
+                std::apply([&](const auto&... result){ 
+                    ((stencils.out[i] = result / dual_area), ...); 
+                }, results);
+            });
         }
 
     };
@@ -0,0 +1,109 @@
+
+// std libraries
+#include <chrono>   // std::chrono
+#include <iostream> // std::cout
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// 3rd party libraries
+#include <glm/vec3.hpp>     // *vec3
+
+#ifdef _OPENMP
+#include <omp.h>    // omp_set_num_threads, omp_get_max_threads
+#endif
+
+// in-house libraries
+#include <grid/dymaxion/Grid.hpp>
+#include <grid/dymaxion/GridCache.hpp>
+
+#include "ExecutionPolicy.hpp"
+#include "VectorCalculusByFundamentalTheorem.hpp"
+
+/*
+`VectorCalculusByFundamentalTheorem_benchmark.cpp` reports the runtime of each operator
+for each `ExecutionPolicy` and thread count, alongside speedup relative to `serial`.
+Results are printed as a tsv so they can be pasted alongside other `*-results.tsv` files.
+Run using `make benchmark`.
+*/
+
+template<typename F>
+double seconds_for(const int repetition_count, const F& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetition_count; ++i)
+    {
+        f();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end-start).count() / repetition_count;
+}
+
+int main(int argc, char** argv)
+{
+    using vec3 = glm::vec3;
+    using Grid = dymaxion::Grid<std::int8_t,int,float>;
+
+    const int vertices_per_square_side(argc > 1? std::stoi(argv[1]) : 120);
+    const int repetition_count(argc > 2? std::stoi(argv[2]) : 10);
+
+    dymaxion::GridCache grid(Grid(1.0f, vertices_per_square_side));
+
+    std::vector<float> scalars(grid.vertex_count());
+    std::vector<vec3> vectors(grid.vertex_count());
+    for (int i = 0; i < grid.vertex_count(); ++i)
+    {
+        const vec3 V = grid.vertex_positions[i];
+        scalars[i] = V.x*V.y + V.z;
+        vectors[i] = glm::cross(V, vec3(0,0,1));
+    }
+    std::vector<float> scalar_out(grid.vertex_count());
+    std::vector<vec3> vector_out(grid.vertex_count());
+
+    #ifdef _OPENMP
+    const int max_thread_count(omp_get_max_threads());
+    #else
+    const int max_thread_count(1);
+    #endif
+
+    std::vector<std::pair<std::string, unlayered::ExecutionPolicy>> policies{
+        {"serial",        unlayered::ExecutionPolicy::serial},
+        {"threaded",      unlayered::ExecutionPolicy::threaded},
+        {"threaded_simd", unlayered::ExecutionPolicy::threaded_simd},
+    };
+
+    std::cout << "vertices_per_square_side\toperator\tpolicy\tthreads\tseconds\tspeedup" << std::endl;
+    for (const std::string name : {"gradient", "divergence", "curl", "laplacian"})
+    {
+        auto run = [&](const unlayered::VectorCalculusByFundamentalTheorem& calculus){
+            if      (name == "gradient")   { calculus.gradient  (grid, scalars, vector_out); }
+            else if (name == "divergence") { calculus.divergence(grid, vectors, scalar_out); }
+            else if (name == "curl")       { calculus.curl      (grid, vectors, vector_out); }
+            else                           { calculus.laplacian (grid, scalars, scalar_out); }
+        };
+        const double serial = seconds_for(repetition_count, [&](){
+            run(unlayered::VectorCalculusByFundamentalTheorem(unlayered::ExecutionPolicy::serial));
+        });
+        for (auto policy : policies)
+        {
+            for (int thread_count = 1; thread_count <= max_thread_count; thread_count *= 2)
+            {
+                #ifdef _OPENMP
+                omp_set_num_threads(thread_count);
+                #endif
+                const double elapsed = seconds_for(repetition_count, [&](){
+                    run(unlayered::VectorCalculusByFundamentalTheorem(policy.second));
+                });
+                std::cout
+                    << vertices_per_square_side << "\t" << name << "\t" << policy.first << "\t"
+                    << thread_count << "\t" << elapsed << "\t" << serial/elapsed << std::endl;
+                if (policy.second == unlayered::ExecutionPolicy::serial)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
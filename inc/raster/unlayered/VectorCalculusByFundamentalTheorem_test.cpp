@@ -12,6 +12,10 @@
 #include <glm/vec3.hpp>     // *vec3
 #include "glm/glm.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>    // omp_set_num_threads, omp_get_max_threads
+#endif
+
 // in-house libraries
 #include <math/glm/special_specialization.hpp>
 #include <math/glm/special.hpp>
@@ -514,6 +518,129 @@ TEST_CASE( "Vector Raster laplacian", "[unlayered]" ) {
 }
 
 
+TEST_CASE( "Raster operators under each ExecutionPolicy", "[unlayered]" ) {
+    dymaxion::Adapter exact(calculus_fine, 0.0, calculus_fine.vertex_count());
+    unlayered::VectorCalculusByFundamentalTheorem serial(unlayered::ExecutionPolicy::serial);
+    unlayered::VectorCalculusByFundamentalTheorem threaded(unlayered::ExecutionPolicy::threaded);
+    unlayered::VectorCalculusByFundamentalTheorem threaded_simd(unlayered::ExecutionPolicy::threaded_simd);
+
+    // threaded policies must be compared using several threads, even on machines with a single core
+    #ifdef _OPENMP
+    const int thread_count(omp_get_max_threads());
+    omp_set_num_threads(4);
+    REQUIRE(omp_get_max_threads() == 4);
+    #endif
+
+    REQUIRE(test::equality(exact, 
+        "threaded gradient must be bit-identical to serial gradient",
+        "threaded.gradient ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(glm::dvec3, calculus_fine, threaded.gradient),
+        "serial.gradient   ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(glm::dvec3, calculus_fine, serial.gradient),
+        scalar_rasters
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "threaded divergence must be bit-identical to serial divergence",
+        "threaded.divergence ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(double, calculus_fine, threaded.divergence),
+        "serial.divergence   ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(double, calculus_fine, serial.divergence),
+        vector_rasters
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "threaded curl must be bit-identical to serial curl",
+        "threaded.curl ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(glm::dvec3, calculus_fine, threaded.curl),
+        "serial.curl   ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(glm::dvec3, calculus_fine, serial.curl),
+        vector_rasters
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "threaded laplacian must be bit-identical to serial laplacian",
+        "threaded.laplacian ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(double, calculus_fine, threaded.laplacian),
+        "serial.laplacian   ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(double, calculus_fine, serial.laplacian),
+        scalar_rasters
+    ));
+
+    // vectorization may contract floating point operations differently, so results need only be close
+    REQUIRE(test::equality(dymaxion::Adapter(calculus_fine, 1e-5, calculus_fine.vertex_count()), 
+        "vectorized laplacian must agree with serial laplacian",
+        "threaded_simd.laplacian ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(double, calculus_fine, threaded_simd.laplacian),
+        "serial.laplacian        ", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(double, calculus_fine, serial.laplacian),
+        scalar_rasters
+    ));
+
+    #ifdef _OPENMP
+    omp_set_num_threads(thread_count);
+    #endif
+
+}
+
+
+TEST_CASE( "Fused raster operators", "[unlayered]" ) {
+    dymaxion::Adapter exact(calculus_fine, 0.0, calculus_fine.vertex_count());
+    unlayered::VectorCalculusByFundamentalTheorem operators;
+
+    REQUIRE(test::equality(exact, 
+        "a fused gradient must be identical to a standalone gradient",
+        "operators.fused(…gradient_stencil, laplacian_stencil)", 
+        [=](auto a){
+            std::vector<glm::dvec3> gradient(calculus_fine.vertex_count());
+            std::vector<double> laplacian(calculus_fine.vertex_count());
+            operators.fused(calculus_fine, a, 
+                unlayered::gradient_stencil(gradient), 
+                unlayered::laplacian_stencil(laplacian));
+            return gradient;
+        },
+        "operators.gradient", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(glm::dvec3, calculus_fine, operators.gradient),
+        scalar_rasters
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "a fused laplacian must be identical to a standalone laplacian",
+        "operators.fused(…gradient_stencil, laplacian_stencil)", 
+        [=](auto a){
+            std::vector<glm::dvec3> gradient(calculus_fine.vertex_count());
+            std::vector<double> laplacian(calculus_fine.vertex_count());
+            operators.fused(calculus_fine, a, 
+                unlayered::gradient_stencil(gradient), 
+                unlayered::laplacian_stencil(laplacian));
+            return laplacian;
+        },
+        "operators.laplacian", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(double, calculus_fine, operators.laplacian),
+        scalar_rasters
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "a fused divergence must be identical to a standalone divergence",
+        "operators.fused(…divergence_stencil, curl_stencil)", 
+        [=](auto V){
+            std::vector<double> divergence(calculus_fine.vertex_count());
+            std::vector<glm::dvec3> curl(calculus_fine.vertex_count());
+            operators.fused(calculus_fine, V, 
+                unlayered::divergence_stencil(divergence), 
+                unlayered::curl_stencil(curl));
+            return divergence;
+        },
+        "operators.divergence", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(double, calculus_fine, operators.divergence),
+        vector_rasters
+    ));
+
+    REQUIRE(test::equality(exact, 
+        "a fused curl must be identical to a standalone curl",
+        "operators.fused(…divergence_stencil, curl_stencil)", 
+        [=](auto V){
+            std::vector<double> divergence(calculus_fine.vertex_count());
+            std::vector<glm::dvec3> curl(calculus_fine.vertex_count());
+            operators.fused(calculus_fine, V, 
+                unlayered::divergence_stencil(divergence), 
+                unlayered::curl_stencil(curl));
+            return curl;
+        },
+        "operators.curl", DYMAXION_TEST_GRIDDED_OUT_PARAMETER(glm::dvec3, calculus_fine, operators.curl),
+        vector_rasters
+    ));
+
+}
+
+
 /*
 TODO:
 * resolution invariance
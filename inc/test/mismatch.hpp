@@ -0,0 +1,22 @@
+#pragma once
+
+// std libraries
+#include <cstddef>  // std::size_t
+
+namespace test {
+
+    /*
+    `mismatch_count(as, bs)` returns the number of indices in `as` where `as` and `bs` store values that are not exactly equal.
+    It is intended for methods that promise results which are identical to those of another method,
+    such as the batched methods of noise, where comparing values within the tolerance of an adapter could hide differences.
+    */
+    template<typename As, typename Bs>
+    int mismatch_count(const As& as, const Bs& bs) {
+        int count(0);
+        for (std::size_t i = 0; i < as.size(); ++i) {
+            count += as[i] != bs[i];
+        }
+        return count;
+    }
+
+}